@@ -0,0 +1,356 @@
+#ifndef BLOCKINGQUEUE_H
+#define BLOCKINGQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "Queue.h"
+
+// Fila concorrente bloqueante sobre Queue<T>, protegida por mutex.
+// Consumidores esperam elementos em vez de sondar empty(); com capacidade
+// limitada, produtores esperam espaço (contrapressão). close() acorda
+// todos: enqueue passa a falhar e os consumidores drenam o que restou.
+//
+// Espera em duas fases: antes de dormir na condition_variable, a thread
+// sonda por alguns ciclos contadores atômicos (sem o mutex). Se um
+// elemento (ou espaço) aparece nesse intervalo, evita-se o custo de
+// dormir e acordar. Produtores e consumidores só chamam notify quando há
+// alguém dormindo do outro lado.
+template<class T>
+class BlockingQueue {
+private:
+    static constexpr int spinLimit = 128;
+
+    mutable std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+
+    Queue<T> items;
+    size_t maxSize;  // 0 = ilimitada
+
+    // Espelhos de items.size() e do fechamento, lidos sem o mutex na fase de spin
+    std::atomic<size_t> itemCount;
+    std::atomic<bool> closedFlag;
+
+    // Threads dormindo (protegidos pelo mutex)
+    size_t waitingConsumers;
+    size_t waitingProducers;
+
+    static void cpuRelax();
+
+    // Sonda ready() por até spinLimit ciclos; retorna true se ficou pronto
+    template<typename Ready>
+    static bool spinUntil(Ready ready);
+
+    bool full() const;
+
+    // Esperas genéricas (spin e depois wait(lock), que dorme e retorna
+    // false em timeout)
+    template<typename Wait>
+    bool dequeueWith(T& out, Wait wait);
+
+    template<typename Wait, typename... Args>
+    bool enqueueWith(Wait wait, Args&&... args);
+
+    // Enfileira com o mutex travado e acorda um consumidor (fora do mutex)
+    template<typename... Args>
+    void pushAndNotify(std::unique_lock<std::mutex>& lock, Args&&... args);
+
+    // Remove o primeiro para out com o mutex travado e acorda um produtor
+    void popAndNotify(std::unique_lock<std::mutex>& lock, T& out);
+
+public:
+    // ==================== CONSTRUTORES ====================
+    // Construtor com capacidade máxima (0 = ilimitada)
+    explicit BlockingQueue(size_t capacity = 0);
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    // ==================== PRODUTORES ====================
+
+    // Tenta enfileirar; retorna false se estiver cheia ou fechada
+    bool tryEnqueue(const T& value);
+    bool tryEnqueue(T&& value);
+
+    // Enfileira esperando espaço; retorna false se a fila for fechada
+    bool waitEnqueue(const T& value);
+    bool waitEnqueue(T&& value);
+
+    template<typename... Args>
+    bool waitEmplace(Args&&... args);
+
+    // ==================== CONSUMIDORES ====================
+
+    // Tenta remover o primeiro elemento para out; retorna false se vazia
+    bool tryDequeue(T& out);
+
+    // Remove até maxCount elementos para out com uma única travada do
+    // mutex; retorna quantos (0 se vazia)
+    template<typename OutputIt>
+    size_t tryDequeueBulk(OutputIt out, size_t maxCount);
+
+    // Espera um elemento; retorna false se a fila foi fechada e está vazia
+    bool waitDequeue(T& out);
+
+    // Como waitDequeue, mas também retorna false ao fim do prazo
+    template<typename Rep, typename Period>
+    bool waitDequeueFor(T& out, const std::chrono::duration<Rep, Period>& timeout);
+
+    template<typename Clock, typename Duration>
+    bool waitDequeueUntil(T& out, const std::chrono::time_point<Clock, Duration>& deadline);
+
+    // ==================== ENCERRAMENTO ====================
+
+    // Fecha a fila e acorda todas as threads esperando
+    void close();
+
+    bool closed() const;
+
+    // ==================== CONSULTA ====================
+
+    size_t size() const;
+    bool empty() const;
+    size_t capacity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtor: com capacidade limitada, o buffer é reservado de uma vez
+template<class T>
+BlockingQueue<T>::BlockingQueue(size_t capacity)
+    : maxSize(capacity), itemCount(0), closedFlag(false), waitingConsumers(0), waitingProducers(0) {
+    if (maxSize > 0) {
+        items.reserve(maxSize);
+    }
+}
+
+// Auxiliares
+template<class T>
+void BlockingQueue<T>::cpuRelax() {
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+template<class T>
+template<typename Ready>
+bool BlockingQueue<T>::spinUntil(Ready ready) {
+    for (int i = 0; i < spinLimit; ++i) {
+        if (ready()) {
+            return true;
+        }
+        cpuRelax();
+    }
+    return ready();
+}
+
+template<class T>
+bool BlockingQueue<T>::full() const {
+    return maxSize != 0 && items.size() >= maxSize;
+}
+
+template<class T>
+template<typename... Args>
+void BlockingQueue<T>::pushAndNotify(std::unique_lock<std::mutex>& lock, Args&&... args) {
+    items.emplace(std::forward<Args>(args)...);
+    itemCount.store(items.size(), std::memory_order_release);
+    bool wake = waitingConsumers > 0;
+    lock.unlock();
+    if (wake) {
+        notEmpty.notify_one();
+    }
+}
+
+template<class T>
+void BlockingQueue<T>::popAndNotify(std::unique_lock<std::mutex>& lock, T& out) {
+    items.tryDequeue(out);
+    itemCount.store(items.size(), std::memory_order_release);
+    bool wake = waitingProducers > 0;
+    lock.unlock();
+    if (wake) {
+        notFull.notify_one();
+    }
+}
+
+// Produtores
+template<class T>
+template<typename Wait, typename... Args>
+bool BlockingQueue<T>::enqueueWith(Wait wait, Args&&... args) {
+    if (maxSize != 0) {
+        spinUntil([this] {
+            return itemCount.load(std::memory_order_relaxed) < maxSize || closedFlag.load(std::memory_order_relaxed);
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        if (closedFlag.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        if (!full()) {
+            break;
+        }
+        ++waitingProducers;
+        bool signalled = wait(lock);
+        --waitingProducers;
+        if (!signalled && full()) {
+            return false;
+        }
+    }
+
+    pushAndNotify(lock, std::forward<Args>(args)...);
+    return true;
+}
+
+template<class T>
+bool BlockingQueue<T>::tryEnqueue(const T& value) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (closedFlag.load(std::memory_order_relaxed) || full()) {
+        return false;
+    }
+    pushAndNotify(lock, value);
+    return true;
+}
+
+template<class T>
+bool BlockingQueue<T>::tryEnqueue(T&& value) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (closedFlag.load(std::memory_order_relaxed) || full()) {
+        return false;
+    }
+    pushAndNotify(lock, std::move(value));
+    return true;
+}
+
+template<class T>
+bool BlockingQueue<T>::waitEnqueue(const T& value) {
+    return waitEmplace(value);
+}
+
+template<class T>
+bool BlockingQueue<T>::waitEnqueue(T&& value) {
+    return waitEmplace(std::move(value));
+}
+
+template<class T>
+template<typename... Args>
+bool BlockingQueue<T>::waitEmplace(Args&&... args) {
+    return enqueueWith([this](std::unique_lock<std::mutex>& lock) {
+        notFull.wait(lock);
+        return true;
+    }, std::forward<Args>(args)...);
+}
+
+// Consumidores
+template<class T>
+template<typename Wait>
+bool BlockingQueue<T>::dequeueWith(T& out, Wait wait) {
+    spinUntil([this] {
+        return itemCount.load(std::memory_order_relaxed) != 0 || closedFlag.load(std::memory_order_relaxed);
+    });
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (items.empty()) {
+        if (closedFlag.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        ++waitingConsumers;
+        bool signalled = wait(lock);
+        --waitingConsumers;
+        if (!signalled && items.empty()) {
+            return false;
+        }
+    }
+
+    popAndNotify(lock, out);
+    return true;
+}
+
+template<class T>
+bool BlockingQueue<T>::tryDequeue(T& out) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (items.empty()) {
+        return false;
+    }
+    popAndNotify(lock, out);
+    return true;
+}
+
+template<class T>
+template<typename OutputIt>
+size_t BlockingQueue<T>::tryDequeueBulk(OutputIt out, size_t maxCount) {
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t removed = items.dequeueBulk(out, maxCount);
+    itemCount.store(items.size(), std::memory_order_release);
+    bool wake = removed > 0 && waitingProducers > 0;
+    lock.unlock();
+    if (wake) {
+        notFull.notify_all();
+    }
+    return removed;
+}
+
+template<class T>
+bool BlockingQueue<T>::waitDequeue(T& out) {
+    return dequeueWith(out, [this](std::unique_lock<std::mutex>& lock) {
+        notEmpty.wait(lock);
+        return true;
+    });
+}
+
+template<class T>
+template<typename Rep, typename Period>
+bool BlockingQueue<T>::waitDequeueFor(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+    return waitDequeueUntil(out, std::chrono::steady_clock::now() + timeout);
+}
+
+template<class T>
+template<typename Clock, typename Duration>
+bool BlockingQueue<T>::waitDequeueUntil(T& out, const std::chrono::time_point<Clock, Duration>& deadline) {
+    return dequeueWith(out, [this, &deadline](std::unique_lock<std::mutex>& lock) {
+        return notEmpty.wait_until(lock, deadline) == std::cv_status::no_timeout;
+    });
+}
+
+// Encerramento
+template<class T>
+void BlockingQueue<T>::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closedFlag.store(true, std::memory_order_relaxed);
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+}
+
+template<class T>
+bool BlockingQueue<T>::closed() const {
+    return closedFlag.load(std::memory_order_acquire);
+}
+
+// Consulta
+template<class T>
+size_t BlockingQueue<T>::size() const {
+    return itemCount.load(std::memory_order_acquire);
+}
+
+template<class T>
+bool BlockingQueue<T>::empty() const {
+    return size() == 0;
+}
+
+template<class T>
+size_t BlockingQueue<T>::capacity() const {
+    return maxSize;
+}
+
+#endif // BLOCKINGQUEUE_H
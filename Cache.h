@@ -0,0 +1,388 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "List.h"
+#include <unordered_map>
+
+// Política de substituição da cache
+enum class CachePolicy {
+    LRU,    // Menos recentemente usado
+    LFU     // Menos frequentemente usado (empate: menos recente)
+};
+
+// Cache chave/valor com get/put em O(1).
+// As entradas vivem em nós de List; um acesso apenas religa o nó
+// (moveToFront / splice), sem liberar nem alocar memória.
+// LRU: uma lista em ordem de recência. LFU: uma lista de baldes em ordem
+// crescente de frequência, cada um com suas entradas; o acesso move o nó
+// para o balde seguinte e a vítima sai sempre do primeiro balde.
+template<class Key, class Value, class Hash = std::hash<Key>>
+class Cache {
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t frequency;
+        size_t weight;
+    };
+
+    // As listas daqui seguem a ordem de recência/frequência mantida pela
+    // Cache, não uma ordem dos valores: todos os elementos são equivalentes
+    struct NoOrder {
+        template<class U>
+        bool operator()(const U&, const U&) const { return false; }
+    };
+
+    using EntryList = List<Entry, NoOrder>;
+    using EntryIterator = typename EntryList::Iterator;
+
+    // Balde LFU: entradas com a mesma frequência (frente = mais recente)
+    struct Bucket {
+        size_t frequency;
+        EntryList entries;
+    };
+
+    using BucketList = List<Bucket, NoOrder>;
+    using BucketIterator = typename BucketList::Iterator;
+
+    CachePolicy policy;
+    size_t maxEntries;
+    size_t maxWeight;
+    size_t totalWeight;
+
+    std::unordered_map<Key, EntryIterator, Hash> index;
+    EntryList recency;                                  // LRU: frente = mais recente
+    BucketList buckets;                                       // LFU: frente = menor frequência
+    std::unordered_map<size_t, BucketIterator> bucketIndex;   // LFU: frequência -> balde
+
+    std::function<size_t(const Key&, const Value&)> weigher;
+    std::function<void(const Key&, Value&)> onEvict;
+
+    size_t hitCount;
+    size_t missCount;
+    size_t evictionCount;
+
+    // Atualiza recência/frequência de uma entrada acessada
+    void touch(EntryIterator it);
+
+    // Remove a vítima da política atual, sem nunca escolher spared
+    void evictOne(const Entry* spared = nullptr);
+
+    // LFU: retira it do seu balde, descartando o balde se ficar vazio
+    void unlinkFromBucket(BucketIterator bucket, EntryIterator it);
+
+    // Remove entradas até caber nos limites de quantidade e peso
+    void evictToFit(size_t incomingWeight);
+
+    size_t weigh(const Key& key, const Value& value) const;
+
+public:
+    // ==================== CONSTRUTORES ====================
+    // Construtor com número máximo de entradas
+    explicit Cache(size_t capacity, CachePolicy cachePolicy = CachePolicy::LRU);
+
+    Cache(const Cache&) = delete;
+    Cache& operator=(const Cache&) = delete;
+
+    // ==================== CONFIGURAÇÃO ====================
+
+    // Limite por peso (além do limite de quantidade)
+    void setWeigher(std::function<size_t(const Key&, const Value&)> weightOf, size_t maxTotalWeight);
+
+    // Callback chamado para cada entrada removida por capacidade
+    void setEvictionCallback(std::function<void(const Key&, Value&)> callback);
+
+    // ==================== OPERAÇÕES ====================
+
+    // Retorna ponteiro para o valor (nullptr se ausente) e marca o acesso
+    Value* get(const Key& key);
+
+    // Copia o valor para out; retorna false se ausente
+    bool get(const Key& key, Value& out);
+
+    // Insere ou atualiza; pode remover outras entradas. Uma entrada mais
+    // pesada que o limite total não é guardada: se a chave já existia, ela
+    // sai da cache (sem callback de remoção), como uma chave nova não entra
+    void put(const Key& key, Value value);
+
+    // Verifica presença sem marcar acesso
+    bool contains(const Key& key) const;
+
+    // Remove entrada (sem chamar o callback de remoção)
+    bool erase(const Key& key);
+
+    void clear();
+
+    // ==================== CONSULTA ====================
+
+    size_t size() const;
+    bool empty() const;
+    size_t capacity() const;
+    size_t weight() const;
+
+    // ==================== ESTATÍSTICAS ====================
+
+    size_t hits() const;
+    size_t misses() const;
+    size_t evictions() const;
+    double hitRate() const;
+    void resetStats();
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtor
+template<class Key, class Value, class Hash>
+Cache<Key, Value, Hash>::Cache(size_t capacity, CachePolicy cachePolicy)
+    : policy(cachePolicy), maxEntries(capacity), maxWeight(SIZE_MAX), totalWeight(0),
+      hitCount(0), missCount(0), evictionCount(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Cache capacity must be positive");
+    }
+    index.reserve(capacity);
+}
+
+// Configuração
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::setWeigher(std::function<size_t(const Key&, const Value&)> weightOf,
+                                         size_t maxTotalWeight) {
+    if (!empty()) {
+        throw std::logic_error("Cache weigher must be set before inserting entries");
+    }
+    weigher = weightOf;
+    maxWeight = maxTotalWeight;
+}
+
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::setEvictionCallback(std::function<void(const Key&, Value&)> callback) {
+    onEvict = callback;
+}
+
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::weigh(const Key& key, const Value& value) const {
+    return weigher ? weigher(key, value) : 1;
+}
+
+// Touch: LRU religa na frente; LFU move para a lista da próxima frequência
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::touch(EntryIterator it) {
+    if (policy == CachePolicy::LRU) {
+        recency.moveToFront(it);
+        return;
+    }
+
+    size_t frequency = it->frequency;
+    BucketIterator from = bucketIndex.find(frequency)->second;
+    BucketIterator to = from;
+    ++to;
+    if (to == buckets.end() || to->frequency != frequency + 1) {
+        to = buckets.emplace(to, Bucket{frequency + 1, EntryList()});
+        bucketIndex.emplace(frequency + 1, to);
+    }
+
+    to->entries.splice(to->entries.begin(), from->entries, it);
+    it->frequency = frequency + 1;
+    if (from->entries.empty()) {
+        bucketIndex.erase(frequency);
+        buckets.erase(from);
+    }
+}
+
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::unlinkFromBucket(BucketIterator bucket, EntryIterator it) {
+    bucket->entries.erase(it);
+    if (bucket->entries.empty()) {
+        bucketIndex.erase(bucket->frequency);
+        buckets.erase(bucket);
+    }
+}
+
+// Evict one: LRU tira o fim da recência; LFU, o menos recente do primeiro balde.
+// spared acabou de ser tocada (frente da sua lista): só é o fim da lista se
+// estiver sozinha no primeiro balde, e então a vítima vem do balde seguinte
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::evictOne(const Entry* spared) {
+    BucketIterator bucket = buckets.begin();
+    if (policy == CachePolicy::LFU && &bucket->entries.back() == spared) {
+        ++bucket;
+    }
+    EntryList& victims = policy == CachePolicy::LFU ? bucket->entries : recency;
+
+    Entry& victim = victims.back();
+    if (onEvict) {
+        onEvict(victim.key, victim.value);
+    }
+    totalWeight -= victim.weight;
+    index.erase(victim.key);
+    ++evictionCount;
+
+    if (policy == CachePolicy::LFU) {
+        unlinkFromBucket(bucket, victims.rbegin());
+    } else {
+        victims.popBack();
+    }
+}
+
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::evictToFit(size_t incomingWeight) {
+    while (!index.empty() &&
+           (index.size() >= maxEntries || totalWeight + incomingWeight > maxWeight)) {
+        evictOne();
+    }
+}
+
+// Get
+template<class Key, class Value, class Hash>
+Value* Cache<Key, Value, Hash>::get(const Key& key) {
+    auto found = index.find(key);
+    if (found == index.end()) {
+        ++missCount;
+        return nullptr;
+    }
+    ++hitCount;
+    touch(found->second);
+    return &found->second->value;
+}
+
+template<class Key, class Value, class Hash>
+bool Cache<Key, Value, Hash>::get(const Key& key, Value& out) {
+    Value* value = get(key);
+    if (value == nullptr) {
+        return false;
+    }
+    out = *value;
+    return true;
+}
+
+// Put
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::put(const Key& key, Value value) {
+    size_t entryWeight = weigh(key, value);
+
+    auto found = index.find(key);
+    if (entryWeight > maxWeight) {
+        // Não cabe nem sozinha: o valor antigo também não fica
+        if (found != index.end()) {
+            erase(key);
+        }
+        return;
+    }
+
+    if (found != index.end()) {
+        EntryIterator it = found->second;
+        totalWeight -= it->weight;
+        it->value = std::move(value);
+        it->weight = entryWeight;
+        totalWeight += entryWeight;
+        touch(it);
+
+        // Novo peso pode exceder o limite: remove outras entradas, nunca esta
+        while (totalWeight > maxWeight) {
+            evictOne(&*it);
+        }
+        return;
+    }
+
+    evictToFit(entryWeight);
+
+    EntryList* target = &recency;
+    if (policy == CachePolicy::LFU) {
+        if (buckets.empty() || buckets.front().frequency != 1) {
+            buckets.emplaceFront(Bucket{1, EntryList()});
+            bucketIndex.emplace(1, buckets.begin());
+        }
+        target = &buckets.front().entries;
+    }
+    target->pushFront(Entry{key, std::move(value), 1, entryWeight});
+    index.emplace(key, target->begin());
+    totalWeight += entryWeight;
+}
+
+// Contains
+template<class Key, class Value, class Hash>
+bool Cache<Key, Value, Hash>::contains(const Key& key) const {
+    return index.find(key) != index.end();
+}
+
+// Erase
+template<class Key, class Value, class Hash>
+bool Cache<Key, Value, Hash>::erase(const Key& key) {
+    auto found = index.find(key);
+    if (found == index.end()) {
+        return false;
+    }
+
+    EntryIterator it = found->second;
+    totalWeight -= it->weight;
+    index.erase(found);
+
+    if (policy == CachePolicy::LRU) {
+        recency.erase(it);
+        return true;
+    }
+
+    unlinkFromBucket(bucketIndex.find(it->frequency)->second, it);
+    return true;
+}
+
+// Clear
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::clear() {
+    index.clear();
+    recency.clear();
+    buckets.clear();
+    bucketIndex.clear();
+    totalWeight = 0;
+}
+
+// Consulta
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::size() const {
+    return index.size();
+}
+
+template<class Key, class Value, class Hash>
+bool Cache<Key, Value, Hash>::empty() const {
+    return index.empty();
+}
+
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::capacity() const {
+    return maxEntries;
+}
+
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::weight() const {
+    return totalWeight;
+}
+
+// Estatísticas
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::hits() const {
+    return hitCount;
+}
+
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::misses() const {
+    return missCount;
+}
+
+template<class Key, class Value, class Hash>
+size_t Cache<Key, Value, Hash>::evictions() const {
+    return evictionCount;
+}
+
+template<class Key, class Value, class Hash>
+double Cache<Key, Value, Hash>::hitRate() const {
+    size_t total = hitCount + missCount;
+    return total == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(total);
+}
+
+template<class Key, class Value, class Hash>
+void Cache<Key, Value, Hash>::resetStats() {
+    hitCount = 0;
+    missCount = 0;
+    evictionCount = 0;
+}
+
+#endif // CACHE_H
@@ -0,0 +1,375 @@
+#ifndef COWLIST_H
+#define COWLIST_H
+
+#include "List.h"
+#include <atomic>
+#include <memory>
+
+// Lista com cópia na escrita (copy-on-write).
+// Cópias compartilham a mesma cadeia de nós (contagem de referências atômica)
+// até que um dos lados altere o conteúdo; só então a cadeia é duplicada.
+// Como os nós de List são duplamente encadeados, a duplicação é da cadeia
+// inteira: não há como compartilhar apenas um sufixo com links prev.
+// Depois de edit() a instância fica "não compartilhável": a referência
+// devolvida pode ser usada para escrever a qualquer momento, então cópias
+// feitas a partir dela duplicam a cadeia em vez de compartilhá-la.
+// Instâncias distintas que compartilham uma cadeia podem ser usadas em
+// threads distintos; uma mesma instância não é sincronizada.
+template<class T>
+class CowList {
+private:
+    std::shared_ptr<List<T>> listPtr; // nullptr representa lista vazia
+    bool unshareable = false;         // edit() entregou uma referência mutável
+
+    // Lista vazia compartilhada para leituras sem alocação
+    static const List<T>& emptyList();
+
+    // Garante posse exclusiva da cadeia antes de uma escrita
+    List<T>& detach();
+
+    // Cadeia para uma nova cópia: compartilhada, ou duplicada se não compartilhável
+    static std::shared_ptr<List<T>> shareFrom(const CowList& other);
+
+public:
+    using ConstIterator = typename List<T>::ConstIterator;
+
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor padrão
+    CowList() = default;
+
+    // Construtor de cópia (O(1): compartilha a cadeia, salvo após edit())
+    CowList(const CowList& other);
+
+    // Construtor de movimento
+    CowList(CowList&& other) noexcept = default;
+
+    // Construtor com lista de inicialização
+    CowList(std::initializer_list<T> init);
+
+    // Construtores a partir de uma List (copia ou assume os nós)
+    explicit CowList(const List<T>& list);
+    explicit CowList(List<T>&& list);
+
+    // Destrutor
+    ~CowList() = default;
+
+    // ==================== OPERADORES DE ATRIBUIÇÃO ====================
+
+    CowList& operator=(const CowList& other);
+    CowList& operator=(CowList&& other) noexcept = default;
+
+    // ==================== ACESSO AO CONTEÚDO ====================
+
+    // Visão somente leitura (nunca copia)
+    const List<T>& view() const;
+
+    // Acesso mutável (copia a cadeia se estiver compartilhada); a referência
+    // vale até a próxima atribuição, clear ou swap desta instância
+    List<T>& edit();
+
+    // Verifica se a cadeia está compartilhada com outras cópias
+    bool shared() const;
+    long useCount() const;
+
+    // ==================== ITERADORES ====================
+
+    ConstIterator begin() const { return view().begin(); }
+    ConstIterator end() const { return view().end(); }
+    ConstIterator cbegin() const { return view().cbegin(); }
+    ConstIterator cend() const { return view().cend(); }
+
+    // ==================== MÉTODOS DE LEITURA ====================
+
+    size_t size() const;
+    bool empty() const;
+    bool sorted() const;
+    const T& at(size_t index) const;
+    const T& operator[](size_t index) const;
+    const T& front() const;
+    const T& back() const;
+    bool contains(const T& value) const;
+    void forEach(std::function<void(const T&)> func) const;
+    std::vector<T> toVector() const;
+
+    // ==================== MÉTODOS DE ESCRITA ====================
+
+    void pushFront(const T& value);
+    void pushFront(T&& value);
+    void pushBack(const T& value);
+    void pushBack(T&& value);
+    void insert(size_t index, const T& value);
+    void insertSorted(const T& value);
+    void popFront();
+    void popBack();
+    void removeAt(size_t index);
+    bool removeFirst(const T& value);
+    size_t removeAll(const T& value);
+    void sort();
+    void reverse();
+    void clear();
+    void swap(CowList& other) noexcept;
+
+    // ==================== OPERADORES ====================
+
+    bool operator==(const CowList& other) const;
+    bool operator!=(const CowList& other) const;
+
+    template<class U>
+    friend std::ostream& operator<<(std::ostream& os, const CowList<U>& list);
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+template<class T>
+const List<T>& CowList<T>::emptyList() {
+    static const List<T> empty;
+    return empty;
+}
+
+// Detach: única cópia real da estrutura.
+// use_count() é uma leitura relaxed. Se outro thread acabou de soltar a
+// última cópia compartilhada, a fence acquire sincroniza com o decremento
+// (release) dele, então as leituras que ele fez da cadeia acontecem antes
+// das nossas escritas.
+template<class T>
+List<T>& CowList<T>::detach() {
+    if (!listPtr) {
+        listPtr = std::make_shared<List<T>>();
+    } else if (listPtr.use_count() > 1) {
+        listPtr = std::make_shared<List<T>>(*listPtr);
+    } else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *listPtr;
+}
+
+template<class T>
+std::shared_ptr<List<T>> CowList<T>::shareFrom(const CowList& other) {
+    if (other.unshareable && other.listPtr) {
+        return std::make_shared<List<T>>(*other.listPtr);
+    }
+    return other.listPtr;
+}
+
+// Construtor de cópia
+template<class T>
+CowList<T>::CowList(const CowList& other) : listPtr(shareFrom(other)) {}
+
+// Construtor com lista de inicialização
+template<class T>
+CowList<T>::CowList(std::initializer_list<T> init)
+    : listPtr(std::make_shared<List<T>>(init)) {}
+
+template<class T>
+CowList<T>::CowList(const List<T>& list)
+    : listPtr(std::make_shared<List<T>>(list)) {}
+
+template<class T>
+CowList<T>::CowList(List<T>&& list)
+    : listPtr(std::make_shared<List<T>>(std::move(list))) {}
+
+// Atribuição por cópia
+template<class T>
+CowList<T>& CowList<T>::operator=(const CowList& other) {
+    if (this != &other) {
+        listPtr = shareFrom(other);
+        unshareable = false;
+    }
+    return *this;
+}
+
+// View / edit
+template<class T>
+const List<T>& CowList<T>::view() const {
+    return listPtr ? *listPtr : emptyList();
+}
+
+template<class T>
+List<T>& CowList<T>::edit() {
+    List<T>& list = detach();
+    unshareable = true;
+    return list;
+}
+
+template<class T>
+bool CowList<T>::shared() const {
+    return listPtr && listPtr.use_count() > 1;
+}
+
+template<class T>
+long CowList<T>::useCount() const {
+    return listPtr.use_count();
+}
+
+// Leitura
+template<class T>
+size_t CowList<T>::size() const {
+    return view().size();
+}
+
+template<class T>
+bool CowList<T>::empty() const {
+    return view().empty();
+}
+
+template<class T>
+bool CowList<T>::sorted() const {
+    return view().sorted();
+}
+
+template<class T>
+const T& CowList<T>::at(size_t index) const {
+    return view().at(index);
+}
+
+template<class T>
+const T& CowList<T>::operator[](size_t index) const {
+    return view().at(index);
+}
+
+template<class T>
+const T& CowList<T>::front() const {
+    return view().front();
+}
+
+template<class T>
+const T& CowList<T>::back() const {
+    return view().back();
+}
+
+template<class T>
+bool CowList<T>::contains(const T& value) const {
+    return view().contains(value);
+}
+
+template<class T>
+void CowList<T>::forEach(std::function<void(const T&)> func) const {
+    view().forEach(func);
+}
+
+template<class T>
+std::vector<T> CowList<T>::toVector() const {
+    return view().toVector();
+}
+
+// Escrita
+template<class T>
+void CowList<T>::pushFront(const T& value) {
+    detach().pushFront(value);
+}
+
+template<class T>
+void CowList<T>::pushFront(T&& value) {
+    detach().pushFront(std::move(value));
+}
+
+template<class T>
+void CowList<T>::pushBack(const T& value) {
+    detach().pushBack(value);
+}
+
+template<class T>
+void CowList<T>::pushBack(T&& value) {
+    detach().pushBack(std::move(value));
+}
+
+template<class T>
+void CowList<T>::insert(size_t index, const T& value) {
+    detach().insert(index, value);
+}
+
+template<class T>
+void CowList<T>::insertSorted(const T& value) {
+    detach().insertSorted(value);
+}
+
+template<class T>
+void CowList<T>::popFront() {
+    if (empty()) {
+        throw std::underflow_error("List is empty");
+    }
+    detach().popFront();
+}
+
+template<class T>
+void CowList<T>::popBack() {
+    if (empty()) {
+        throw std::underflow_error("List is empty");
+    }
+    detach().popBack();
+}
+
+template<class T>
+void CowList<T>::removeAt(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    detach().removeAt(index);
+}
+
+template<class T>
+bool CowList<T>::removeFirst(const T& value) {
+    // Evita copiar a cadeia quando não há o que remover
+    if (!contains(value)) {
+        return false;
+    }
+    return detach().removeFirst(value);
+}
+
+template<class T>
+size_t CowList<T>::removeAll(const T& value) {
+    if (!contains(value)) {
+        return 0;
+    }
+    return detach().removeAll(value);
+}
+
+template<class T>
+void CowList<T>::sort() {
+    if (sorted()) {
+        return;
+    }
+    detach().sort();
+}
+
+template<class T>
+void CowList<T>::reverse() {
+    if (size() <= 1) {
+        return;
+    }
+    detach().reverse();
+}
+
+// Clear: solta a referência sem tocar nas outras cópias
+template<class T>
+void CowList<T>::clear() {
+    listPtr.reset();
+    unshareable = false;
+}
+
+template<class T>
+void CowList<T>::swap(CowList& other) noexcept {
+    listPtr.swap(other.listPtr);
+    std::swap(unshareable, other.unshareable);
+}
+
+// Operadores
+template<class T>
+bool CowList<T>::operator==(const CowList& other) const {
+    if (listPtr == other.listPtr) {
+        return true;
+    }
+    return view() == other.view();
+}
+
+template<class T>
+bool CowList<T>::operator!=(const CowList& other) const {
+    return !(*this == other);
+}
+
+template<class T>
+std::ostream& operator<<(std::ostream& os, const CowList<T>& list) {
+    return os << list.view();
+}
+
+#endif // COWLIST_H
@@ -0,0 +1,499 @@
+#ifndef DELAYQUEUE_H
+#define DELAYQUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "PriorityQueue.h"
+
+// Fila de atrasos: itens agendados para um instante (deadline, em ticks
+// de resolução escolhida pelo usuário, ex.: milissegundos) e entregues
+// por pollExpired(now) em ordem de deadline.
+//
+// Roda de tempo hierárquica: levels níveis de 64 slots; o nível l cobre
+// ticks de 64^l em 64^l. Um timer vai para o nível do bit mais alto em que
+// seu deadline difere do tempo atual, no slot dado pelos 6 bits desse
+// nível. Ao atravessar a fronteira de um bloco do nível l, o slot
+// correspondente é redistribuído nos níveis inferiores (cascata).
+// schedule e cancel são O(1): listas duplamente encadeadas de índices num
+// vetor de nós, mais um bitmap de 64 bits por nível com os slots ocupados.
+// pollExpired salta direto para o próximo slot ocupado pelos bitmaps, em
+// vez de percorrer tick a tick.
+//
+// Deadlines além do alcance da roda (64^levels ticks) ficam num heap
+// (PriorityQueue) e entram na roda quando o tempo chega ao bloco deles.
+template<class T>
+class DelayQueue {
+public:
+    using Tick = uint64_t;
+
+    // Identifica um agendamento (copiável, sem posse)
+    class Handle {
+        friend class DelayQueue;
+
+    private:
+        uint32_t index;
+        uint32_t generation;
+
+        Handle(uint32_t nodeIndex, uint32_t nodeGeneration) : index(nodeIndex), generation(nodeGeneration) {}
+
+    public:
+        // Handle inválido
+        Handle() : index(std::numeric_limits<uint32_t>::max()), generation(0) {}
+
+        bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const Handle& other) const { return !(*this == other); }
+    };
+
+private:
+    static constexpr size_t levels = 4;
+    static constexpr size_t slotBits = 6;
+    static constexpr size_t slotCount = size_t(1) << slotBits;
+    static constexpr size_t wheelBits = levels * slotBits;
+    static constexpr uint32_t nil = std::numeric_limits<uint32_t>::max();
+
+    enum class Location : uint8_t {
+        Free,
+        Wheel,
+        Overdue,
+        Heap
+    };
+
+    // Entrada do heap de deadlines distantes
+    struct FarEntry {
+        Tick deadline;
+        uint32_t index;
+
+        // Menor deadline = maior prioridade
+        bool operator<(const FarEntry& other) const { return deadline > other.deadline; }
+    };
+
+    using FarHeap = PriorityQueue<FarEntry>;
+
+    struct Node {
+        Tick deadline;
+        uint32_t prev;
+        uint32_t next;        // Também encadeia a lista de nós livres
+        uint32_t generation;
+        Location location;
+        uint8_t level;
+        uint8_t slot;
+        typename FarHeap::Handle farHandle;
+        std::optional<T> item;
+    };
+
+    struct List {
+        uint32_t head = nil;
+        uint32_t tail = nil;
+    };
+
+    std::vector<Node> nodes;
+    uint32_t freeHead;
+    List wheel[levels][slotCount];
+    uint64_t occupied[levels];  // Bit s = slot s do nível não vazio
+    List overdue;               // Agendados para antes do tempo atual
+    FarHeap far;
+    Tick current;
+    size_t scheduled;
+
+    // Métodos auxiliares privados
+    uint32_t allocateNode();
+    void releaseNode(uint32_t index);
+    Node& checkHandle(const Handle& handle);
+    const Node& checkHandle(const Handle& handle) const;
+
+    void append(List& list, uint32_t index);
+    void unlink(List& list, uint32_t index);
+
+    // Insere em overdue mantendo a ordem de deadline (estável: empates
+    // ficam em ordem de chegada); procura a posição a partir do fim
+    void insertOverdue(uint32_t index);
+
+    // Coloca o nó no lugar certo para o tempo atual (overdue, roda ou heap)
+    void place(uint32_t index);
+
+    // Próximo instante (> ou = current) em que algum slot ou o heap precisa
+    // ser processado; vazio se não houver nenhum
+    std::optional<Tick> nextEvent() const;
+
+    // Processa o instante current: heap -> roda, cascata e expiração
+    template<typename Container>
+    size_t processCurrent(Container& out);
+
+    // Move o item do primeiro nó de list para out, depois o retira da lista
+    // e o libera; se push_back lançar, o nó continua na lista
+    template<typename Container>
+    void expireFront(List& list, Container& out);
+
+public:
+    // ==================== CONSTRUTORES ====================
+    // Construtor com o tempo inicial
+    explicit DelayQueue(Tick start = 0);
+
+    DelayQueue(const DelayQueue&) = delete;
+    DelayQueue& operator=(const DelayQueue&) = delete;
+
+    // ==================== MÉTODOS PRINCIPAIS ====================
+
+    // Agenda item para deadline (deadline <= tempo atual: sai no próximo
+    // poll). O(1); no passado, O(k) para k itens já vencidos com deadline
+    // maior, que ele precisa ultrapassar para manter a ordem
+    Handle schedule(Tick deadline, const T& item);
+    Handle schedule(Tick deadline, T&& item);
+
+    // Cancela o agendamento; retorna false se já expirou ou foi cancelado
+    bool cancel(const Handle& handle);
+
+    // Avança o tempo até now e coloca em out (push_back) os itens com
+    // deadline <= now, em ordem de deadline; retorna quantos
+    template<typename Container>
+    size_t pollExpired(Tick now, Container& out);
+
+    // ==================== MÉTODOS DE CONSULTA ====================
+
+    // O agendamento ainda está pendente?
+    bool contains(const Handle& handle) const;
+
+    // Deadline de um agendamento pendente
+    Tick deadline(const Handle& handle) const;
+
+    // Tempo atual (último now passado a pollExpired)
+    Tick now() const;
+
+    // Limite inferior para o próximo deadline pendente (max se vazia);
+    // um laço de eventos pode dormir até lá
+    Tick nextWakeup() const;
+
+    bool empty() const;
+    size_t size() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtor
+template<class T>
+DelayQueue<T>::DelayQueue(Tick start) : freeHead(nil), occupied{}, current(start), scheduled(0) {}
+
+// Nós: vetor com lista livre; a geração invalida handles antigos
+template<class T>
+uint32_t DelayQueue<T>::allocateNode() {
+    if (freeHead != nil) {
+        uint32_t index = freeHead;
+        freeHead = nodes[index].next;
+        return index;
+    }
+    if (nodes.size() >= nil) {
+        throw std::length_error("DelayQueue is full");
+    }
+    nodes.push_back(Node{0, nil, nil, 0, Location::Free, 0, 0, typename FarHeap::Handle(), std::nullopt});
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+template<class T>
+void DelayQueue<T>::releaseNode(uint32_t index) {
+    Node& node = nodes[index];
+    node.item.reset();
+    node.location = Location::Free;
+    ++node.generation;
+    node.prev = nil;
+    node.next = freeHead;
+    freeHead = index;
+    --scheduled;
+}
+
+template<class T>
+typename DelayQueue<T>::Node& DelayQueue<T>::checkHandle(const Handle& handle) {
+    if (!contains(handle)) {
+        throw std::invalid_argument("Invalid delay queue handle");
+    }
+    return nodes[handle.index];
+}
+
+template<class T>
+const typename DelayQueue<T>::Node& DelayQueue<T>::checkHandle(const Handle& handle) const {
+    if (!contains(handle)) {
+        throw std::invalid_argument("Invalid delay queue handle");
+    }
+    return nodes[handle.index];
+}
+
+// Listas intrusivas
+template<class T>
+void DelayQueue<T>::append(List& list, uint32_t index) {
+    Node& node = nodes[index];
+    node.prev = list.tail;
+    node.next = nil;
+    if (list.tail != nil) {
+        nodes[list.tail].next = index;
+    } else {
+        list.head = index;
+    }
+    list.tail = index;
+}
+
+template<class T>
+void DelayQueue<T>::unlink(List& list, uint32_t index) {
+    Node& node = nodes[index];
+    if (node.prev != nil) {
+        nodes[node.prev].next = node.next;
+    } else {
+        list.head = node.next;
+    }
+    if (node.next != nil) {
+        nodes[node.next].prev = node.prev;
+    } else {
+        list.tail = node.prev;
+    }
+    node.prev = nil;
+    node.next = nil;
+}
+
+template<class T>
+void DelayQueue<T>::insertOverdue(uint32_t index) {
+    Tick deadline = nodes[index].deadline;
+    uint32_t before = overdue.tail;
+    while (before != nil && nodes[before].deadline > deadline) {
+        before = nodes[before].prev;
+    }
+    if (before == overdue.tail) {
+        append(overdue, index);
+        return;
+    }
+
+    // Entra logo depois de before (ou na cabeça, se before for nil)
+    Node& node = nodes[index];
+    uint32_t after = before != nil ? nodes[before].next : overdue.head;
+    node.prev = before;
+    node.next = after;
+    nodes[after].prev = index;
+    if (before != nil) {
+        nodes[before].next = index;
+    } else {
+        overdue.head = index;
+    }
+}
+
+// Place: nível = bit mais alto em que deadline e current diferem
+template<class T>
+void DelayQueue<T>::place(uint32_t index) {
+    Node& node = nodes[index];
+    if (node.deadline <= current) {
+        node.location = Location::Overdue;
+        insertOverdue(index);
+        return;
+    }
+
+    Tick difference = node.deadline ^ current;
+    size_t highestBit = 63 - static_cast<size_t>(__builtin_clzll(difference));
+    size_t level = highestBit / slotBits;
+    if (level >= levels) {
+        node.location = Location::Heap;
+        node.farHandle = far.enqueue(FarEntry{node.deadline, index});
+        return;
+    }
+
+    size_t slot = static_cast<size_t>(node.deadline >> (level * slotBits)) & (slotCount - 1);
+    node.location = Location::Wheel;
+    node.level = static_cast<uint8_t>(level);
+    node.slot = static_cast<uint8_t>(slot);
+    append(wheel[level][slot], index);
+    occupied[level] |= uint64_t(1) << slot;
+}
+
+// Next event: em cada nível, o slot ocupado mais baixo marca o início do
+// seu bloco; todo slot ocupado está à frente do dígito atual do nível.
+// Vazio (e não max) quando não há nada: max é um deadline válido
+template<class T>
+std::optional<typename DelayQueue<T>::Tick> DelayQueue<T>::nextEvent() const {
+    std::optional<Tick> next;
+    for (size_t level = 0; level < levels; ++level) {
+        if (occupied[level] != 0) {
+            size_t shift = (level + 1) * slotBits;
+            Tick base = (current >> shift) << shift;
+            Tick slot = static_cast<Tick>(__builtin_ctzll(occupied[level]));
+            Tick time = base | (slot << (level * slotBits));
+            if (!next || time < *next) {
+                next = time;
+            }
+        }
+    }
+    if (!far.empty()) {
+        Tick base = (far.front().deadline >> wheelBits) << wheelBits;
+        if (!next || base < *next) {
+            next = base;
+        }
+    }
+    return next;
+}
+
+template<class T>
+template<typename Container>
+void DelayQueue<T>::expireFront(List& list, Container& out) {
+    uint32_t index = list.head;
+    out.push_back(std::move(*nodes[index].item));
+    unlink(list, index);
+    releaseNode(index);
+}
+
+// Process current: do nível mais alto para o mais baixo, para que a
+// cascata de um nível alimente os de baixo no mesmo instante
+template<class T>
+template<typename Container>
+size_t DelayQueue<T>::processCurrent(Container& out) {
+    while (!far.empty() && (far.front().deadline ^ current) >> wheelBits == 0) {
+        uint32_t index = far.dequeueAndReturn().index;
+        place(index);
+    }
+
+    for (size_t level = levels; level-- > 1;) {
+        Tick lowerMask = (Tick(1) << (level * slotBits)) - 1;
+        size_t slot = static_cast<size_t>(current >> (level * slotBits)) & (slotCount - 1);
+        if ((current & lowerMask) != 0 || (occupied[level] & (uint64_t(1) << slot)) == 0) {
+            continue;
+        }
+        uint32_t index = wheel[level][slot].head;
+        wheel[level][slot] = List();
+        occupied[level] &= ~(uint64_t(1) << slot);
+        while (index != nil) {
+            uint32_t following = nodes[index].next;
+            place(index);
+            index = following;
+        }
+    }
+
+    // Nível 0: o slot atual contém exatamente os deadlines == current,
+    // e os que a cascata trouxe para current estão em overdue
+    size_t expired = 0;
+    size_t slot = static_cast<size_t>(current) & (slotCount - 1);
+    // Um nó por vez: se out lançar, o slot e seu bit continuam coerentes
+    // e o restante expira no próximo poll
+    if (occupied[0] & (uint64_t(1) << slot)) {
+        List& list = wheel[0][slot];
+        while (list.head != nil) {
+            expireFront(list, out);
+            ++expired;
+        }
+        occupied[0] &= ~(uint64_t(1) << slot);
+    }
+    while (overdue.head != nil) {
+        expireFront(overdue, out);
+        ++expired;
+    }
+    return expired;
+}
+
+// Schedule
+template<class T>
+typename DelayQueue<T>::Handle DelayQueue<T>::schedule(Tick deadline, const T& item) {
+    return schedule(deadline, T(item));
+}
+
+template<class T>
+typename DelayQueue<T>::Handle DelayQueue<T>::schedule(Tick deadline, T&& item) {
+    uint32_t index = allocateNode();
+    Node& node = nodes[index];
+    node.deadline = deadline;
+    ++scheduled;
+    try {
+        node.item.emplace(std::move(item));
+        place(index);
+    } catch (...) {
+        releaseNode(index);
+        throw;
+    }
+    return Handle(index, node.generation);
+}
+
+// Cancel
+template<class T>
+bool DelayQueue<T>::cancel(const Handle& handle) {
+    if (!contains(handle)) {
+        return false;
+    }
+
+    Node& node = nodes[handle.index];
+    switch (node.location) {
+    case Location::Wheel: {
+        List& list = wheel[node.level][node.slot];
+        unlink(list, handle.index);
+        if (list.head == nil) {
+            occupied[node.level] &= ~(uint64_t(1) << node.slot);
+        }
+        break;
+    }
+    case Location::Overdue:
+        unlink(overdue, handle.index);
+        break;
+    case Location::Heap:
+        far.erase(node.farHandle);
+        break;
+    case Location::Free:
+        return false;
+    }
+    releaseNode(handle.index);
+    return true;
+}
+
+// Poll expired: salta de evento em evento até now
+template<class T>
+template<typename Container>
+size_t DelayQueue<T>::pollExpired(Tick now, Container& out) {
+    size_t expired = 0;
+
+    // Agendados no passado desde o último poll
+    while (overdue.head != nil) {
+        expireFront(overdue, out);
+        ++expired;
+    }
+
+    while (true) {
+        std::optional<Tick> next = nextEvent();
+        if (!next || *next > now) {
+            break;
+        }
+        current = *next;
+        expired += processCurrent(out);
+    }
+    if (now > current) {
+        current = now;
+    }
+    return expired;
+}
+
+// Consulta
+template<class T>
+bool DelayQueue<T>::contains(const Handle& handle) const {
+    return handle.index < nodes.size() && nodes[handle.index].generation == handle.generation &&
+           nodes[handle.index].location != Location::Free;
+}
+
+template<class T>
+typename DelayQueue<T>::Tick DelayQueue<T>::deadline(const Handle& handle) const {
+    return checkHandle(handle).deadline;
+}
+
+template<class T>
+typename DelayQueue<T>::Tick DelayQueue<T>::now() const {
+    return current;
+}
+
+template<class T>
+typename DelayQueue<T>::Tick DelayQueue<T>::nextWakeup() const {
+    return overdue.head != nil ? current : nextEvent().value_or(std::numeric_limits<Tick>::max());
+}
+
+template<class T>
+bool DelayQueue<T>::empty() const {
+    return scheduled == 0;
+}
+
+template<class T>
+size_t DelayQueue<T>::size() const {
+    return scheduled;
+}
+
+#endif // DELAYQUEUE_H
@@ -0,0 +1,1097 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include "OutputBuffer.h"
+#include "MemoryUsage.h"
+
+// Sequência em blocos de tamanho fixo com um mapa de ponteiros para os blocos.
+// pushFront/pushBack/popFront/popBack e at() são O(1); os elementos ficam
+// contíguos dentro de cada bloco (boa localidade para percorrer).
+// Alternativa a List quando o uso é inserção nas pontas e acesso por índice.
+// Referências permanecem válidas em inserções/remoções nas pontas
+// (exceto as do elemento removido); iteradores são invalidados.
+template<class T>
+class Deque {
+private:
+    // ~4 KiB por bloco, potência de dois (divisão vira deslocamento), mínimo de 16
+    static constexpr size_t computeBlockCapacity() {
+        size_t wanted = 4096 / sizeof(T);
+        size_t capacity = 16;
+        while (capacity * 2 <= wanted) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    static constexpr size_t blockCapacity = computeBlockCapacity();
+
+    T** blockMap;       // Ponteiros para blocos; não nulos só na faixa em uso
+    size_t mapCapacity;
+    size_t mapBegin;    // Índice no mapa do primeiro bloco em uso
+    size_t start;       // Posição do primeiro elemento dentro do primeiro bloco
+    size_t dequeSize;
+    T* spareBlock;      // Último bloco liberado, reutilizado na próxima alocação
+
+    // Métodos auxiliares privados
+    T* allocateBlock();
+    void releaseBlock(T* block);
+    static void deallocateBlock(T* block);
+    size_t usedBlocks() const;
+    void reserveMap();              // Garante um bloco livre em cada ponta do mapa
+    void resetEmpty(size_t blocks); // Libera os blocos que restavam em uso quando a sequência esvazia
+    T* slot(size_t index) const;    // Endereço do elemento index (sem verificação)
+
+    template<typename... Args>
+    void constructBack(Args&&... args);
+
+    template<typename... Args>
+    void constructFront(Args&&... args);
+
+    // Escreve os elementos no buffer (usado por operator<<, print e writeTo)
+    void writeElements(OutputBuffer& out, size_t previewCount) const;
+
+public:
+    // ==================== ITERADORES ====================
+    // Iterador de acesso aleatório (posição lógica + sequência)
+    template<bool IsConst>
+    class BasicIterator {
+    private:
+        using Owner = typename std::conditional<IsConst, const Deque, Deque>::type;
+
+        Owner* owner;
+        size_t index;
+        friend class Deque;
+        template<bool> friend class BasicIterator;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        BasicIterator(Owner* deque = nullptr, size_t position = 0) : owner(deque), index(position) {}
+
+        // Iterador mutável converte para constante
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : owner(other.owner), index(other.index) {}
+
+        reference operator*() const { return *owner->slot(index); }
+        pointer operator->() const { return owner->slot(index); }
+        reference operator[](difference_type offset) const { return *owner->slot(index + offset); }
+
+        BasicIterator& operator++() { ++index; return *this; }
+        BasicIterator operator++(int) { BasicIterator temp = *this; ++index; return temp; }
+        BasicIterator& operator--() { --index; return *this; }
+        BasicIterator operator--(int) { BasicIterator temp = *this; --index; return temp; }
+
+        BasicIterator& operator+=(difference_type offset) { index += offset; return *this; }
+        BasicIterator& operator-=(difference_type offset) { index -= offset; return *this; }
+        BasicIterator operator+(difference_type offset) const { return BasicIterator(owner, index + offset); }
+        BasicIterator operator-(difference_type offset) const { return BasicIterator(owner, index - offset); }
+        friend BasicIterator operator+(difference_type offset, const BasicIterator& it) { return it + offset; }
+
+        difference_type operator-(const BasicIterator& other) const {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const BasicIterator& other) const { return index == other.index; }
+        bool operator!=(const BasicIterator& other) const { return index != other.index; }
+        bool operator<(const BasicIterator& other) const { return index < other.index; }
+        bool operator>(const BasicIterator& other) const { return index > other.index; }
+        bool operator<=(const BasicIterator& other) const { return index <= other.index; }
+        bool operator>=(const BasicIterator& other) const { return index >= other.index; }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor padrão
+    Deque();
+
+    // Construtor de cópia
+    Deque(const Deque& other);
+
+    // Construtor de movimento
+    Deque(Deque&& other) noexcept;
+
+    // Construtor com lista de inicialização
+    Deque(std::initializer_list<T> init);
+
+    // Construtor com tamanho e valor padrão
+    Deque(size_t count, const T& value = T{});
+
+    // Construtor a partir de intervalo de iteradores
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Deque(InputIt first, InputIt last);
+
+    // Destrutor
+    ~Deque();
+
+    // ==================== OPERADORES DE ATRIBUIÇÃO ====================
+
+    // Operador de atribuição por cópia
+    Deque& operator=(const Deque& other);
+
+    // Operador de atribuição por movimento
+    Deque& operator=(Deque&& other) noexcept;
+
+    // ==================== ITERADORES ====================
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, dequeSize); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, dequeSize); }
+    ConstIterator cbegin() const { return ConstIterator(this, 0); }
+    ConstIterator cend() const { return ConstIterator(this, dequeSize); }
+
+    // ==================== MÉTODOS DE INSERÇÃO ====================
+
+    // Insere no início
+    void pushFront(const T& value);
+    void pushFront(T&& value);
+
+    // Insere no final
+    void pushBack(const T& value);
+    void pushBack(T&& value);
+
+    // Construção in-place
+    template<typename... Args>
+    void emplaceFront(Args&&... args);
+
+    template<typename... Args>
+    void emplaceBack(Args&&... args);
+
+    // Adiciona um intervalo inteiro no final (move os elementos se receber rvalue)
+    template<typename Range>
+    void append(Range&& range);
+
+    // ==================== MÉTODOS DE REMOÇÃO ====================
+
+    // Remove do início
+    void popFront();
+    T popFrontAndReturn();
+
+    // Remove do final
+    void popBack();
+    T popBackAndReturn();
+
+    // Remove elementos que satisfazem condição (estável); retorna quantos
+    template<typename Predicate>
+    size_t removeIf(Predicate pred);
+
+    // Remove todas as ocorrências
+    size_t removeAll(const T& value);
+
+    // ==================== MÉTODOS DE ACESSO ====================
+
+    // Acesso por índice em O(1)
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+
+    // Primeiro e último elemento
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    // ==================== MÉTODOS DE CONSULTA ====================
+
+    // Tamanho e estado
+    size_t size() const;
+    bool empty() const;
+
+    // Memória ocupada: blocos, payload, slack do alocador, mapa e DeepSize<T>
+    MemoryUsage memoryUsage() const;
+
+    // Busca linear
+    bool contains(const T& value) const;
+    size_t count(const T& value) const;
+    int findFirst(const T& value) const;
+    int findLast(const T& value) const;
+
+    // ==================== MÉTODOS DE ORDENAÇÃO ====================
+
+    // Ordenação estável (operator< ou comparador)
+    void sort();
+    void sort(std::function<bool(const T&, const T&)> comparator);
+
+    // Verifica se está ordenada
+    bool isSortedCheck() const;
+
+    // ==================== OPERAÇÕES DE MANIPULAÇÃO ====================
+
+    // Limpa a sequência (mantém o mapa; libera os blocos)
+    void clear();
+
+    // Inverte a sequência
+    void reverse();
+
+    // Troca conteúdo
+    void swap(Deque& other) noexcept;
+
+    // Redimensiona
+    void resize(size_t newSize, const T& value = T{});
+
+    // Libera o bloco reserva e reduz o mapa ao necessário
+    void shrinkToFit();
+
+    // ==================== MÉTODOS FUNCIONAIS ====================
+
+    // Aplica função a todos os elementos
+    void forEach(std::function<void(T&)> func);
+    void forEach(std::function<void(const T&)> func) const;
+
+    // Predicados
+    bool allOf(std::function<bool(const T&)> predicate) const;
+    bool anyOf(std::function<bool(const T&)> predicate) const;
+    bool noneOf(std::function<bool(const T&)> predicate) const;
+
+    // Transformação
+    template<typename U>
+    Deque<U> map(std::function<U(const T&)> mapper) const;
+
+    // Filtro
+    Deque filter(std::function<bool(const T&)> predicate) const;
+
+    // Redução
+    template<typename U>
+    U reduce(U initial, std::function<U(U, const T&)> reducer) const;
+
+    // ==================== CONVERSÕES ====================
+
+    // Converte para vetor
+    std::vector<T> toVector() const;
+
+    // ==================== OPERADORES DE COMPARAÇÃO ====================
+
+    bool operator==(const Deque& other) const;
+    bool operator!=(const Deque& other) const;
+
+    // ==================== OPERADOR DE SAÍDA ====================
+
+    template<class U>
+    friend std::ostream& operator<<(std::ostream& os, const Deque<U>& deque);
+
+    // ==================== MÉTODOS DE DEBUG ====================
+
+    // Imprime estrutura da sequência
+    void print() const;
+
+    // Escrita bufferizada no formato de operator<<
+    // (previewCount > 0 mostra só os primeiros e últimos previewCount elementos)
+    void writeTo(std::ostream& os, size_t previewCount = 0) const;
+    void writeTo(int fd, size_t previewCount = 0) const;
+
+    // Verifica integridade da estrutura
+    bool checkIntegrity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Blocos: memória bruta para blockCapacity elementos
+template<class T>
+T* Deque<T>::allocateBlock() {
+    if (spareBlock != nullptr) {
+        T* block = spareBlock;
+        spareBlock = nullptr;
+        return block;
+    }
+    T* block = static_cast<T*>(::operator new(blockCapacity * sizeof(T)));
+    if (MemoryCounters::enabled) {
+        MemoryCounters::recordAllocation(ContainerKind::Deque, blockCapacity * sizeof(T));
+    }
+    return block;
+}
+
+template<class T>
+void Deque<T>::releaseBlock(T* block) {
+    if (spareBlock == nullptr) {
+        spareBlock = block;
+    } else {
+        deallocateBlock(block);
+    }
+}
+
+template<class T>
+void Deque<T>::deallocateBlock(T* block) {
+    if (MemoryCounters::enabled) {
+        MemoryCounters::recordRelease(ContainerKind::Deque, blockCapacity * sizeof(T));
+    }
+    ::operator delete(block);
+}
+
+template<class T>
+size_t Deque<T>::usedBlocks() const {
+    return dequeSize == 0 ? 0 : (start + dequeSize - 1) / blockCapacity + 1;
+}
+
+// Reserve map: recentraliza os blocos em uso ou dobra o mapa
+template<class T>
+void Deque<T>::reserveMap() {
+    size_t used = usedBlocks();
+    size_t needed = 2 * (used + 1);
+
+    if (mapCapacity >= needed) {
+        // Espaço suficiente: apenas recentraliza
+        size_t newBegin = (mapCapacity - used) / 2;
+        if (newBegin < mapBegin) {
+            std::copy(blockMap + mapBegin, blockMap + mapBegin + used, blockMap + newBegin);
+        } else {
+            std::copy_backward(blockMap + mapBegin, blockMap + mapBegin + used, blockMap + newBegin + used);
+        }
+        std::fill(blockMap, blockMap + newBegin, nullptr);
+        std::fill(blockMap + newBegin + used, blockMap + mapCapacity, nullptr);
+        mapBegin = newBegin;
+        return;
+    }
+
+    size_t newCapacity = std::max<size_t>(8, 2 * mapCapacity);
+    while (newCapacity < needed) {
+        newCapacity *= 2;
+    }
+
+    T** newMap = new T*[newCapacity]();
+    size_t newBegin = (newCapacity - used) / 2;
+    if (used > 0) {
+        std::copy(blockMap + mapBegin, blockMap + mapBegin + used, newMap + newBegin);
+    }
+    delete[] blockMap;
+    blockMap = newMap;
+    mapCapacity = newCapacity;
+    mapBegin = newBegin;
+}
+
+// Reset empty: sem elementos, a sequência recomeça no centro do mapa
+template<class T>
+void Deque<T>::resetEmpty(size_t blocks) {
+    for (size_t i = mapBegin; i < mapBegin + blocks; ++i) {
+        releaseBlock(blockMap[i]);
+        blockMap[i] = nullptr;
+    }
+    start = 0;
+    mapBegin = mapCapacity / 2;
+}
+
+template<class T>
+T* Deque<T>::slot(size_t index) const {
+    size_t position = start + index;
+    return blockMap[mapBegin + position / blockCapacity] + position % blockCapacity;
+}
+
+// Construct back: aloca bloco novo quando a próxima posição inicia um bloco
+template<class T>
+template<typename... Args>
+void Deque<T>::constructBack(Args&&... args) {
+    size_t position = start + dequeSize;
+    size_t offset = position % blockCapacity;
+
+    if (offset == 0) {
+        if (mapBegin + position / blockCapacity >= mapCapacity) {
+            reserveMap();
+        }
+        size_t blockIndex = mapBegin + position / blockCapacity;
+        blockMap[blockIndex] = allocateBlock();
+        try {
+            new (blockMap[blockIndex]) T(std::forward<Args>(args)...);
+        } catch (...) {
+            releaseBlock(blockMap[blockIndex]);
+            blockMap[blockIndex] = nullptr;
+            throw;
+        }
+    } else {
+        new (blockMap[mapBegin + position / blockCapacity] + offset) T(std::forward<Args>(args)...);
+    }
+    ++dequeSize;
+}
+
+// Construct front: ao sair do primeiro bloco, usa o bloco anterior do mapa
+template<class T>
+template<typename... Args>
+void Deque<T>::constructFront(Args&&... args) {
+    if (start > 0) {
+        new (blockMap[mapBegin] + start - 1) T(std::forward<Args>(args)...);
+        --start;
+        ++dequeSize;
+        return;
+    }
+
+    if (mapBegin == 0) {
+        reserveMap();
+    }
+    T* block = allocateBlock();
+    try {
+        new (block + blockCapacity - 1) T(std::forward<Args>(args)...);
+    } catch (...) {
+        releaseBlock(block);
+        throw;
+    }
+    if (dequeSize == 0) {
+        // Sem blocos em uso: o novo bloco é o próprio mapBegin
+        blockMap[mapBegin] = block;
+    } else {
+        blockMap[--mapBegin] = block;
+    }
+    start = blockCapacity - 1;
+    ++dequeSize;
+}
+
+// Construtor padrão
+template<class T>
+Deque<T>::Deque()
+    : blockMap(nullptr), mapCapacity(0), mapBegin(0), start(0), dequeSize(0), spareBlock(nullptr) {}
+
+// Construtor de cópia
+template<class T>
+Deque<T>::Deque(const Deque& other) : Deque() {
+    *this = other;
+}
+
+// Construtor de movimento
+template<class T>
+Deque<T>::Deque(Deque&& other) noexcept
+    : blockMap(other.blockMap), mapCapacity(other.mapCapacity), mapBegin(other.mapBegin),
+      start(other.start), dequeSize(other.dequeSize), spareBlock(other.spareBlock) {
+    other.blockMap = nullptr;
+    other.mapCapacity = 0;
+    other.mapBegin = 0;
+    other.start = 0;
+    other.dequeSize = 0;
+    other.spareBlock = nullptr;
+}
+
+// Construtor com lista de inicialização
+template<class T>
+Deque<T>::Deque(std::initializer_list<T> init) : Deque() {
+    for (const auto& item : init) {
+        constructBack(item);
+    }
+}
+
+// Construtor com tamanho e valor
+template<class T>
+Deque<T>::Deque(size_t count, const T& value) : Deque() {
+    for (size_t i = 0; i < count; ++i) {
+        constructBack(value);
+    }
+}
+
+// Construtor a partir de intervalo
+template<class T>
+template<typename InputIt, typename>
+Deque<T>::Deque(InputIt first, InputIt last) : Deque() {
+    for (; first != last; ++first) {
+        constructBack(*first);
+    }
+}
+
+// Destrutor
+template<class T>
+Deque<T>::~Deque() {
+    clear();
+    if (spareBlock != nullptr) {
+        deallocateBlock(spareBlock);
+    }
+    delete[] blockMap;
+}
+
+// Operador de atribuição por cópia
+template<class T>
+Deque<T>& Deque<T>::operator=(const Deque& other) {
+    if (this != &other) {
+        clear();
+        for (size_t i = 0; i < other.dequeSize; ++i) {
+            constructBack(*other.slot(i));
+        }
+    }
+    return *this;
+}
+
+// Operador de atribuição por movimento
+template<class T>
+Deque<T>& Deque<T>::operator=(Deque&& other) noexcept {
+    if (this != &other) {
+        Deque temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+// Push methods
+template<class T>
+void Deque<T>::pushFront(const T& value) {
+    constructFront(value);
+}
+
+template<class T>
+void Deque<T>::pushFront(T&& value) {
+    constructFront(std::move(value));
+}
+
+template<class T>
+void Deque<T>::pushBack(const T& value) {
+    constructBack(value);
+}
+
+template<class T>
+void Deque<T>::pushBack(T&& value) {
+    constructBack(std::move(value));
+}
+
+template<class T>
+template<typename... Args>
+void Deque<T>::emplaceFront(Args&&... args) {
+    constructFront(std::forward<Args>(args)...);
+}
+
+template<class T>
+template<typename... Args>
+void Deque<T>::emplaceBack(Args&&... args) {
+    constructBack(std::forward<Args>(args)...);
+}
+
+// Append
+template<class T>
+template<typename Range>
+void Deque<T>::append(Range&& range) {
+    for (auto&& item : range) {
+        if constexpr (std::is_rvalue_reference<Range&&>::value) {
+            constructBack(std::move(item));
+        } else {
+            constructBack(item);
+        }
+    }
+}
+
+// Pop methods
+template<class T>
+void Deque<T>::popFront() {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+
+    blockMap[mapBegin][start].~T();
+    --dequeSize;
+
+    if (dequeSize == 0) {
+        resetEmpty(1);
+    } else if (++start == blockCapacity) {
+        releaseBlock(blockMap[mapBegin]);
+        blockMap[mapBegin++] = nullptr;
+        start = 0;
+    }
+}
+
+template<class T>
+T Deque<T>::popFrontAndReturn() {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+    T value = std::move(front());
+    popFront();
+    return value;
+}
+
+template<class T>
+void Deque<T>::popBack() {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+
+    size_t position = start + dequeSize - 1;
+    size_t blockIndex = mapBegin + position / blockCapacity;
+    blockMap[blockIndex][position % blockCapacity].~T();
+    --dequeSize;
+
+    if (dequeSize == 0) {
+        resetEmpty(1);
+    } else if (position % blockCapacity == 0) {
+        releaseBlock(blockMap[blockIndex]);
+        blockMap[blockIndex] = nullptr;
+    }
+}
+
+template<class T>
+T Deque<T>::popBackAndReturn() {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+    T value = std::move(back());
+    popBack();
+    return value;
+}
+
+// Remove if: compacta os mantidos para o início e descarta o final
+template<class T>
+template<typename Predicate>
+size_t Deque<T>::removeIf(Predicate pred) {
+    size_t kept = 0;
+    for (size_t i = 0; i < dequeSize; ++i) {
+        T* current = slot(i);
+        if (!pred(*current)) {
+            if (kept != i) {
+                *slot(kept) = std::move(*current);
+            }
+            ++kept;
+        }
+    }
+
+    size_t removed = dequeSize - kept;
+    while (dequeSize > kept) {
+        popBack();
+    }
+    return removed;
+}
+
+template<class T>
+size_t Deque<T>::removeAll(const T& value) {
+    return removeIf([&value](const T& item) { return item == value; });
+}
+
+// Access methods
+template<class T>
+T& Deque<T>::at(size_t index) {
+    if (index >= dequeSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return *slot(index);
+}
+
+template<class T>
+const T& Deque<T>::at(size_t index) const {
+    if (index >= dequeSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return *slot(index);
+}
+
+template<class T>
+T& Deque<T>::operator[](size_t index) {
+    return at(index);
+}
+
+template<class T>
+const T& Deque<T>::operator[](size_t index) const {
+    return at(index);
+}
+
+template<class T>
+T& Deque<T>::front() {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+    return blockMap[mapBegin][start];
+}
+
+template<class T>
+const T& Deque<T>::front() const {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+    return blockMap[mapBegin][start];
+}
+
+template<class T>
+T& Deque<T>::back() {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+    return *slot(dequeSize - 1);
+}
+
+template<class T>
+const T& Deque<T>::back() const {
+    if (empty()) {
+        throw std::underflow_error("Deque is empty");
+    }
+    return *slot(dequeSize - 1);
+}
+
+// Query methods
+template<class T>
+size_t Deque<T>::size() const {
+    return dequeSize;
+}
+
+template<class T>
+bool Deque<T>::empty() const {
+    return dequeSize == 0;
+}
+
+// Memory usage: blocos inteiros contam como "nós"; posições livres ficam fora de payloadBytes
+template<class T>
+MemoryUsage Deque<T>::memoryUsage() const {
+    size_t blocks = usedBlocks() + (spareBlock != nullptr ? 1 : 0);
+
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    usage.nodeBytes = blocks * blockCapacity * sizeof(T);
+    usage.payloadBytes = dequeSize * sizeof(T);
+    usage.slackBytes = blocks * allocationSlack(blockCapacity * sizeof(T));
+    if (mapCapacity > 0) {
+        usage.overheadBytes = allocationSize(mapCapacity * sizeof(T*));
+    }
+    if (DeepSize<T>::indirect) {
+        for (size_t i = 0; i < dequeSize; ++i) {
+            usage.deepBytes += DeepSize<T>::of(*slot(i));
+        }
+    }
+    return usage;
+}
+
+// Linear search (percorre bloco a bloco)
+template<class T>
+bool Deque<T>::contains(const T& value) const {
+    return findFirst(value) != -1;
+}
+
+template<class T>
+size_t Deque<T>::count(const T& value) const {
+    size_t occurrences = 0;
+    forEach([&value, &occurrences](const T& item) {
+        if (item == value) {
+            ++occurrences;
+        }
+    });
+    return occurrences;
+}
+
+template<class T>
+int Deque<T>::findFirst(const T& value) const {
+    size_t index = 0;
+    size_t offset = start;
+    for (size_t block = mapBegin; index < dequeSize; ++block, offset = 0) {
+        const T* data = blockMap[block];
+        size_t limit = std::min(blockCapacity, offset + (dequeSize - index));
+        for (; offset < limit; ++offset, ++index) {
+            if (data[offset] == value) {
+                return static_cast<int>(index);
+            }
+        }
+    }
+    return -1;
+}
+
+template<class T>
+int Deque<T>::findLast(const T& value) const {
+    for (size_t i = dequeSize; i > 0; --i) {
+        if (*slot(i - 1) == value) {
+            return static_cast<int>(i - 1);
+        }
+    }
+    return -1;
+}
+
+// Sort methods (estáveis, como List::sort)
+template<class T>
+void Deque<T>::sort() {
+    std::stable_sort(begin(), end());
+}
+
+template<class T>
+void Deque<T>::sort(std::function<bool(const T&, const T&)> comparator) {
+    std::stable_sort(begin(), end(), comparator);
+}
+
+template<class T>
+bool Deque<T>::isSortedCheck() const {
+    for (size_t i = 1; i < dequeSize; ++i) {
+        if (*slot(i) < *slot(i - 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Clear
+template<class T>
+void Deque<T>::clear() {
+    if (dequeSize == 0) {
+        return;
+    }
+    if (!std::is_trivially_destructible<T>::value) {
+        for (size_t i = 0; i < dequeSize; ++i) {
+            slot(i)->~T();
+        }
+    }
+    size_t blocks = usedBlocks();
+    dequeSize = 0;
+    resetEmpty(blocks);
+}
+
+// Reverse
+template<class T>
+void Deque<T>::reverse() {
+    std::reverse(begin(), end());
+}
+
+// Swap
+template<class T>
+void Deque<T>::swap(Deque& other) noexcept {
+    std::swap(blockMap, other.blockMap);
+    std::swap(mapCapacity, other.mapCapacity);
+    std::swap(mapBegin, other.mapBegin);
+    std::swap(start, other.start);
+    std::swap(dequeSize, other.dequeSize);
+    std::swap(spareBlock, other.spareBlock);
+}
+
+// Resize
+template<class T>
+void Deque<T>::resize(size_t newSize, const T& value) {
+    while (dequeSize > newSize) {
+        popBack();
+    }
+    while (dequeSize < newSize) {
+        constructBack(value);
+    }
+}
+
+// Shrink to fit
+template<class T>
+void Deque<T>::shrinkToFit() {
+    if (spareBlock != nullptr) {
+        deallocateBlock(spareBlock);
+        spareBlock = nullptr;
+    }
+
+    size_t used = usedBlocks();
+    if (used == 0) {
+        delete[] blockMap;
+        blockMap = nullptr;
+        mapCapacity = 0;
+        mapBegin = 0;
+        return;
+    }
+
+    size_t newCapacity = used + 2;
+    if (newCapacity >= mapCapacity) {
+        return;
+    }
+    T** newMap = new T*[newCapacity]();
+    std::copy(blockMap + mapBegin, blockMap + mapBegin + used, newMap + 1);
+    delete[] blockMap;
+    blockMap = newMap;
+    mapCapacity = newCapacity;
+    mapBegin = 1;
+}
+
+// Functional methods (percorrem bloco a bloco)
+template<class T>
+void Deque<T>::forEach(std::function<void(T&)> func) {
+    size_t index = 0;
+    size_t offset = start;
+    for (size_t block = mapBegin; index < dequeSize; ++block, offset = 0) {
+        T* data = blockMap[block];
+        size_t limit = std::min(blockCapacity, offset + (dequeSize - index));
+        index += limit - offset;
+        for (; offset < limit; ++offset) {
+            func(data[offset]);
+        }
+    }
+}
+
+template<class T>
+void Deque<T>::forEach(std::function<void(const T&)> func) const {
+    size_t index = 0;
+    size_t offset = start;
+    for (size_t block = mapBegin; index < dequeSize; ++block, offset = 0) {
+        const T* data = blockMap[block];
+        size_t limit = std::min(blockCapacity, offset + (dequeSize - index));
+        index += limit - offset;
+        for (; offset < limit; ++offset) {
+            func(data[offset]);
+        }
+    }
+}
+
+template<class T>
+bool Deque<T>::allOf(std::function<bool(const T&)> predicate) const {
+    for (size_t i = 0; i < dequeSize; ++i) {
+        if (!predicate(*slot(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class T>
+bool Deque<T>::anyOf(std::function<bool(const T&)> predicate) const {
+    for (size_t i = 0; i < dequeSize; ++i) {
+        if (predicate(*slot(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<class T>
+bool Deque<T>::noneOf(std::function<bool(const T&)> predicate) const {
+    return !anyOf(predicate);
+}
+
+template<class T>
+template<typename U>
+Deque<U> Deque<T>::map(std::function<U(const T&)> mapper) const {
+    Deque<U> result;
+    forEach([&result, &mapper](const T& item) { result.pushBack(mapper(item)); });
+    return result;
+}
+
+template<class T>
+Deque<T> Deque<T>::filter(std::function<bool(const T&)> predicate) const {
+    Deque<T> result;
+    forEach([&result, &predicate](const T& item) {
+        if (predicate(item)) {
+            result.pushBack(item);
+        }
+    });
+    return result;
+}
+
+template<class T>
+template<typename U>
+U Deque<T>::reduce(U initial, std::function<U(U, const T&)> reducer) const {
+    U result = initial;
+    forEach([&result, &reducer](const T& item) { result = reducer(result, item); });
+    return result;
+}
+
+// Conversions
+template<class T>
+std::vector<T> Deque<T>::toVector() const {
+    std::vector<T> result;
+    result.reserve(dequeSize);
+    forEach([&result](const T& item) { result.push_back(item); });
+    return result;
+}
+
+// Comparison operators
+template<class T>
+bool Deque<T>::operator==(const Deque& other) const {
+    if (dequeSize != other.dequeSize) {
+        return false;
+    }
+    for (size_t i = 0; i < dequeSize; ++i) {
+        if (!(*slot(i) == *other.slot(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class T>
+bool Deque<T>::operator!=(const Deque& other) const {
+    return !(*this == other);
+}
+
+// Print (bufferizado; termina com '\n' sem forçar flush)
+template<class T>
+void Deque<T>::print() const {
+    OutputBuffer out(std::cout);
+    out.append("Deque [size=");
+    out.appendValue(dequeSize);
+    out.append(", blocks=");
+    out.appendValue(usedBlocks());
+    out.append("]: ");
+    if (empty()) {
+        out.append("(empty)");
+    } else {
+        writeElements(out, 0);
+    }
+    out.append('\n');
+    out.flush();
+}
+
+// Escreve "[a, b, c]" ou, em modo preview, "[a, b, ... (n omitted), y, z]"
+template<class T>
+void Deque<T>::writeElements(OutputBuffer& out, size_t previewCount) const {
+    bool truncated = previewCount > 0 && 2 * previewCount < dequeSize;
+    size_t leading = truncated ? previewCount : dequeSize;
+
+    out.append('[');
+    for (size_t i = 0; i < leading; ++i) {
+        if (i > 0) {
+            out.append(", ", 2);
+        }
+        out.appendValue(*slot(i));
+    }
+
+    if (truncated) {
+        out.append(", ... (");
+        out.appendValue(dequeSize - 2 * previewCount);
+        out.append(" omitted)");
+        for (size_t i = dequeSize - previewCount; i < dequeSize; ++i) {
+            out.append(", ", 2);
+            out.appendValue(*slot(i));
+        }
+    }
+    out.append(']');
+}
+
+template<class T>
+void Deque<T>::writeTo(std::ostream& os, size_t previewCount) const {
+    OutputBuffer out(os);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
+}
+
+template<class T>
+void Deque<T>::writeTo(int fd, size_t previewCount) const {
+    OutputBuffer out(fd);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
+}
+
+// Check integrity: blocos não nulos exatamente na faixa em uso
+template<class T>
+bool Deque<T>::checkIntegrity() const {
+    if (dequeSize == 0) {
+        for (size_t i = 0; i < mapCapacity; ++i) {
+            if (blockMap[i] != nullptr) {
+                return false;
+            }
+        }
+        return start == 0;
+    }
+
+    if (start >= blockCapacity) {
+        return false;
+    }
+
+    size_t used = usedBlocks();
+    if (mapBegin + used > mapCapacity) {
+        return false;
+    }
+    for (size_t i = 0; i < mapCapacity; ++i) {
+        bool inUse = i >= mapBegin && i < mapBegin + used;
+        if ((blockMap[i] != nullptr) != inUse) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Output operator
+template<class T>
+std::ostream& operator<<(std::ostream& os, const Deque<T>& deque) {
+    OutputBuffer out(os);
+    deque.writeElements(out, 0);
+    out.flush();
+    return os;
+}
+
+#endif // DEQUE_H
@@ -0,0 +1,569 @@
+#ifndef EXTERNALSORT_H
+#define EXTERNALSORT_H
+
+#include "List.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <queue>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Ordenação externa (merge sort em disco) para dados maiores que a memória.
+// Os elementos são acumulados em runs do tamanho do orçamento de memória,
+// cada run é ordenado em memória e gravado em arquivo temporário; ao final
+// os runs são intercalados (k-way merge) de volta para List, arquivo ou callback.
+// Formato binário: sequência crua de T, portanto T deve ser trivialmente copiável.
+
+// Configuração da ordenação externa
+struct ExternalSortOptions {
+    size_t memoryBudget = size_t(256) << 20;  // Bytes para runs e buffers de merge
+    std::string tempDirectory = "/tmp";       // Diretório dos runs temporários
+    size_t ioBufferSize = size_t(1) << 20;    // Buffer sequencial por arquivo
+    bool directIO = false;                    // Usa O_DIRECT quando disponível
+};
+
+// ==================== ARQUIVOS BINÁRIOS ====================
+
+// Escrita sequencial com buffer alinhado (requisito de O_DIRECT)
+class ExternalRunWriter {
+private:
+    static constexpr size_t alignment = 4096;
+
+    int fd;
+    bool direct;
+    char* buffer;
+    size_t bufferSize;
+    size_t used;
+    uint64_t written;
+
+    void flushBuffer(size_t bytes);
+
+public:
+    ExternalRunWriter(const std::string& path, size_t bufferBytes, bool directIO);
+    ~ExternalRunWriter();
+
+    ExternalRunWriter(const ExternalRunWriter&) = delete;
+    ExternalRunWriter& operator=(const ExternalRunWriter&) = delete;
+
+    void write(const void* data, size_t bytes);
+
+    // Grava o restante do buffer e fecha o arquivo
+    void close();
+};
+
+// Leitura sequencial com buffer alinhado
+class ExternalRunReader {
+private:
+    static constexpr size_t alignment = 4096;
+
+    int fd;
+    char* buffer;
+    size_t bufferSize;
+    size_t available;
+    size_t position;
+
+    bool fill();
+
+public:
+    ExternalRunReader(const std::string& path, size_t bufferBytes, bool directIO);
+    ~ExternalRunReader();
+
+    ExternalRunReader(const ExternalRunReader&) = delete;
+    ExternalRunReader& operator=(const ExternalRunReader&) = delete;
+
+    // Lê exatamente bytes; retorna false no fim do arquivo
+    bool read(void* data, size_t bytes);
+};
+
+// ==================== ORDENADOR ====================
+
+template<class T, class Compare = std::less<T>>
+class ExternalSorter {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ExternalSorter requires a trivially copyable T");
+
+private:
+    ExternalSortOptions options;
+    Compare comp;
+    std::vector<T> run;                 // Run em construção
+    size_t runCapacity;
+    std::vector<std::string> runFiles;  // Runs já gravados em disco
+    bool finished;
+
+    // Ordena o run atual e grava em arquivo temporário
+    void spillRun();
+
+    std::string makeTempFile() const;
+
+    // Lê o próximo elemento; T é construído por cópia dos bytes lidos,
+    // sem exigir construtor padrão
+    static std::optional<T> readValue(ExternalRunReader& reader);
+    size_t mergeBufferSize(size_t runCount) const;
+    size_t maxFanIn() const;
+
+    // Intercala runs chamando consumer para cada elemento, em ordem
+    template<typename Consumer>
+    void mergeRuns(const std::vector<std::string>& files, Consumer consumer);
+
+    // Reduz o número de runs até caber em uma única passada de merge
+    void reduceRuns();
+
+    template<typename Consumer>
+    void finish(Consumer consumer);
+
+    void removeRunFiles();
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    explicit ExternalSorter(ExternalSortOptions sortOptions = ExternalSortOptions(), Compare compare = Compare());
+
+    // Destrutor (remove arquivos temporários)
+    ~ExternalSorter();
+
+    ExternalSorter(const ExternalSorter&) = delete;
+    ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+    // ==================== ENTRADA ====================
+
+    // Adiciona um elemento (fonte em streaming)
+    void add(const T& value);
+
+    // Adiciona um intervalo
+    template<typename InputIt>
+    void add(InputIt first, InputIt last);
+
+    // Consome uma lista, liberando os nós à medida que são lidos
+    void add(List<T>& list);
+
+    // Adiciona o conteúdo de um arquivo no formato binário
+    void addFile(const std::string& path);
+
+    // Número de runs gravados em disco até agora
+    size_t spilledRuns() const;
+
+    // ==================== SAÍDA ====================
+
+    // Entrega o resultado ordenado em uma List
+    List<T> finishToList();
+
+    // Grava o resultado ordenado em arquivo no formato binário
+    void finishToFile(const std::string& path);
+
+    // Entrega cada elemento ordenado a um callback
+    void finishTo(std::function<void(const T&)> consumer);
+};
+
+// Ordena uma List através de ordenação externa (a lista é consumida e refeita)
+template<class T, class Compare = std::less<T>>
+void externalSort(List<T>& list, const ExternalSortOptions& options = ExternalSortOptions(),
+                  Compare compare = Compare());
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Abre arquivo, tentando O_DIRECT quando solicitado
+inline int externalSortOpen(const std::string& path, int flags, bool directIO, bool& direct) {
+    direct = false;
+#ifdef O_DIRECT
+    if (directIO) {
+        int fd = ::open(path.c_str(), flags | O_DIRECT, 0600);
+        if (fd >= 0) {
+            direct = true;
+            return fd;
+        }
+    }
+#else
+    (void)directIO;
+#endif
+    int fd = ::open(path.c_str(), flags, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+    }
+    return fd;
+}
+
+inline char* externalSortAllocBuffer(size_t bytes, size_t alignment) {
+    void* memory = nullptr;
+    if (posix_memalign(&memory, alignment, bytes) != 0) {
+        throw std::bad_alloc();
+    }
+    return static_cast<char*>(memory);
+}
+
+inline size_t externalSortRoundBuffer(size_t bytes, size_t alignment) {
+    return bytes < alignment ? alignment : bytes - bytes % alignment;
+}
+
+// Writer
+inline ExternalRunWriter::ExternalRunWriter(const std::string& path, size_t bufferBytes, bool directIO)
+    : fd(-1), direct(false), buffer(nullptr), bufferSize(externalSortRoundBuffer(bufferBytes, alignment)),
+      used(0), written(0) {
+    fd = externalSortOpen(path, O_WRONLY | O_CREAT | O_TRUNC, directIO, direct);
+    try {
+        buffer = externalSortAllocBuffer(bufferSize, alignment);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+inline ExternalRunWriter::~ExternalRunWriter() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    std::free(buffer);
+}
+
+inline void ExternalRunWriter::flushBuffer(size_t bytes) {
+    size_t offset = 0;
+    while (offset < bytes) {
+        ssize_t result = ::write(fd, buffer + offset, bytes - offset);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("External sort write failed: ") + std::strerror(errno));
+        }
+        offset += static_cast<size_t>(result);
+    }
+}
+
+inline void ExternalRunWriter::write(const void* data, size_t bytes) {
+    const char* source = static_cast<const char*>(data);
+    while (bytes > 0) {
+        size_t chunk = std::min(bytes, bufferSize - used);
+        std::memcpy(buffer + used, source, chunk);
+        used += chunk;
+        source += chunk;
+        bytes -= chunk;
+        if (used == bufferSize) {
+            flushBuffer(used);
+            written += used;
+            used = 0;
+        }
+    }
+}
+
+// Close: com O_DIRECT o último bloco é completado e o arquivo truncado
+inline void ExternalRunWriter::close() {
+    if (fd < 0) {
+        return;
+    }
+    if (used > 0) {
+        if (direct) {
+            size_t padded = (used + alignment - 1) / alignment * alignment;
+            std::memset(buffer + used, 0, padded - used);
+            flushBuffer(padded);
+            if (::ftruncate(fd, static_cast<off_t>(written + used)) != 0) {
+                throw std::runtime_error(std::string("External sort truncate failed: ") + std::strerror(errno));
+            }
+        } else {
+            flushBuffer(used);
+        }
+        written += used;
+        used = 0;
+    }
+    ::close(fd);
+    fd = -1;
+}
+
+// Reader
+inline ExternalRunReader::ExternalRunReader(const std::string& path, size_t bufferBytes, bool directIO)
+    : fd(-1), buffer(nullptr), bufferSize(externalSortRoundBuffer(bufferBytes, alignment)),
+      available(0), position(0) {
+    bool direct;
+    fd = externalSortOpen(path, O_RDONLY, directIO, direct);
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (!direct) {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#endif
+    try {
+        buffer = externalSortAllocBuffer(bufferSize, alignment);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+inline ExternalRunReader::~ExternalRunReader() {
+    ::close(fd);
+    std::free(buffer);
+}
+
+inline bool ExternalRunReader::fill() {
+    while (true) {
+        ssize_t result = ::read(fd, buffer, bufferSize);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("External sort read failed: ") + std::strerror(errno));
+        }
+        available = static_cast<size_t>(result);
+        position = 0;
+        return available > 0;
+    }
+}
+
+inline bool ExternalRunReader::read(void* data, size_t bytes) {
+    char* target = static_cast<char*>(data);
+    size_t copied = 0;
+    while (copied < bytes) {
+        if (position == available && !fill()) {
+            if (copied != 0) {
+                throw std::runtime_error("External sort file is truncated");
+            }
+            return false;
+        }
+        size_t chunk = std::min(bytes - copied, available - position);
+        std::memcpy(target + copied, buffer + position, chunk);
+        position += chunk;
+        copied += chunk;
+    }
+    return true;
+}
+
+// Construtor: metade do orçamento para o run, metade para o buffer do stable_sort
+template<class T, class Compare>
+ExternalSorter<T, Compare>::ExternalSorter(ExternalSortOptions sortOptions, Compare compare)
+    : options(std::move(sortOptions)), comp(compare), finished(false) {
+    runCapacity = std::max<size_t>(1, options.memoryBudget / (2 * sizeof(T)));
+}
+
+template<class T, class Compare>
+ExternalSorter<T, Compare>::~ExternalSorter() {
+    removeRunFiles();
+}
+
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::removeRunFiles() {
+    for (const auto& file : runFiles) {
+        ::unlink(file.c_str());
+    }
+    runFiles.clear();
+}
+
+template<class T, class Compare>
+std::string ExternalSorter<T, Compare>::makeTempFile() const {
+    std::string pattern = options.tempDirectory + "/extsort-XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+    int fd = ::mkstemp(path.data());
+    if (fd < 0) {
+        throw std::runtime_error("Cannot create temporary file in " + options.tempDirectory +
+                                 ": " + std::strerror(errno));
+    }
+    ::close(fd);
+    return std::string(path.data());
+}
+
+// Spill run
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::spillRun() {
+    if (run.empty()) {
+        return;
+    }
+
+    std::stable_sort(run.begin(), run.end(), comp);
+
+    std::string path = makeTempFile();
+    runFiles.push_back(path);
+    ExternalRunWriter writer(path, options.ioBufferSize, options.directIO);
+    writer.write(run.data(), run.size() * sizeof(T));
+    writer.close();
+
+    run.clear();
+}
+
+// Entrada
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::add(const T& value) {
+    if (finished) {
+        throw std::logic_error("ExternalSorter already finished");
+    }
+    if (run.capacity() == 0) {
+        run.reserve(runCapacity);
+    }
+    run.push_back(value);
+    if (run.size() >= runCapacity) {
+        spillRun();
+    }
+}
+
+template<class T, class Compare>
+template<typename InputIt>
+void ExternalSorter<T, Compare>::add(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+        add(*first);
+    }
+}
+
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::add(List<T>& list) {
+    while (!list.empty()) {
+        add(list.front());
+        list.popFront();
+    }
+}
+
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::addFile(const std::string& path) {
+    ExternalRunReader reader(path, options.ioBufferSize, options.directIO);
+    while (std::optional<T> value = readValue(reader)) {
+        add(*value);
+    }
+}
+
+template<class T, class Compare>
+size_t ExternalSorter<T, Compare>::spilledRuns() const {
+    return runFiles.size();
+}
+
+template<class T, class Compare>
+std::optional<T> ExternalSorter<T, Compare>::readValue(ExternalRunReader& reader) {
+    alignas(T) unsigned char bytes[sizeof(T)];
+    if (!reader.read(bytes, sizeof(T))) {
+        return std::nullopt;
+    }
+    return *std::launder(reinterpret_cast<const T*>(bytes));
+}
+
+// Buffer por run no merge: divide o orçamento entre leitores e a saída
+template<class T, class Compare>
+size_t ExternalSorter<T, Compare>::mergeBufferSize(size_t runCount) const {
+    size_t share = options.memoryBudget / (runCount + 1);
+    return std::max<size_t>(4096, std::min(share, options.ioBufferSize));
+}
+
+template<class T, class Compare>
+size_t ExternalSorter<T, Compare>::maxFanIn() const {
+    return std::max<size_t>(2, options.memoryBudget / std::max<size_t>(options.ioBufferSize, 4096) - 1);
+}
+
+// K-way merge com heap; empate favorece o run mais antigo (estabilidade)
+template<class T, class Compare>
+template<typename Consumer>
+void ExternalSorter<T, Compare>::mergeRuns(const std::vector<std::string>& files, Consumer consumer) {
+    struct Entry {
+        T value;
+        size_t source;
+    };
+
+    size_t bufferBytes = mergeBufferSize(files.size());
+    std::vector<std::unique_ptr<ExternalRunReader>> readers;
+    readers.reserve(files.size());
+    for (const auto& file : files) {
+        readers.emplace_back(new ExternalRunReader(file, bufferBytes, options.directIO));
+    }
+
+    const Compare& compare = comp;
+    auto greater = [&compare](const Entry& a, const Entry& b) {
+        if (compare(b.value, a.value)) return true;
+        if (compare(a.value, b.value)) return false;
+        return a.source > b.source;
+    };
+    std::priority_queue<Entry, std::vector<Entry>, decltype(greater)> heap(greater);
+
+    for (size_t i = 0; i < readers.size(); ++i) {
+        if (std::optional<T> value = readValue(*readers[i])) {
+            heap.push(Entry{*value, i});
+        }
+    }
+
+    while (!heap.empty()) {
+        Entry entry = heap.top();
+        heap.pop();
+        consumer(entry.value);
+        if (std::optional<T> value = readValue(*readers[entry.source])) {
+            heap.push(Entry{*value, entry.source});
+        }
+    }
+}
+
+// Passadas intermediárias quando há mais runs do que o fan-in permite.
+// Os runs de entrada continuam em runFiles até a passada terminar; os
+// novos (next) são removidos aqui se um merge lançar
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::reduceRuns() {
+    size_t fanIn = maxFanIn();
+    while (runFiles.size() > fanIn) {
+        std::vector<std::string> next;
+        next.reserve((runFiles.size() + fanIn - 1) / fanIn);
+        try {
+            for (size_t start = 0; start < runFiles.size(); start += fanIn) {
+                size_t stop = std::min(runFiles.size(), start + fanIn);
+                std::vector<std::string> group(runFiles.begin() + start, runFiles.begin() + stop);
+
+                next.push_back(makeTempFile());
+                ExternalRunWriter writer(next.back(), mergeBufferSize(group.size()), options.directIO);
+                mergeRuns(group, [&writer](const T& value) { writer.write(&value, sizeof(T)); });
+                writer.close();
+
+                for (const auto& file : group) {
+                    ::unlink(file.c_str());
+                }
+            }
+        } catch (...) {
+            for (const auto& file : next) {
+                ::unlink(file.c_str());
+            }
+            throw;
+        }
+        runFiles.swap(next);
+    }
+}
+
+// Finish: sem spill o resultado sai direto da memória
+template<class T, class Compare>
+template<typename Consumer>
+void ExternalSorter<T, Compare>::finish(Consumer consumer) {
+    if (finished) {
+        throw std::logic_error("ExternalSorter already finished");
+    }
+    finished = true;
+
+    if (runFiles.empty()) {
+        std::stable_sort(run.begin(), run.end(), comp);
+        for (const auto& value : run) {
+            consumer(value);
+        }
+        std::vector<T>().swap(run);
+        return;
+    }
+
+    spillRun();
+    std::vector<T>().swap(run);
+    reduceRuns();
+    mergeRuns(runFiles, consumer);
+    removeRunFiles();
+}
+
+template<class T, class Compare>
+List<T> ExternalSorter<T, Compare>::finishToList() {
+    List<T> result;
+    finish([&result](const T& value) { result.pushBack(value); });
+    return result;
+}
+
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::finishToFile(const std::string& path) {
+    ExternalRunWriter writer(path, options.ioBufferSize, options.directIO);
+    finish([&writer](const T& value) { writer.write(&value, sizeof(T)); });
+    writer.close();
+}
+
+template<class T, class Compare>
+void ExternalSorter<T, Compare>::finishTo(std::function<void(const T&)> consumer) {
+    finish(consumer);
+}
+
+// External sort de List
+template<class T, class Compare>
+void externalSort(List<T>& list, const ExternalSortOptions& options, Compare compare) {
+    ExternalSorter<T, Compare> sorter(options, compare);
+    sorter.add(list);
+    list = sorter.finishToList();
+}
+
+#endif // EXTERNALSORT_H
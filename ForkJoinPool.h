@@ -0,0 +1,442 @@
+#ifndef FORKJOINPOOL_H
+#define FORKJOINPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Queue.h"
+#include "WorkStealingDeque.h"
+
+// Pool fork-join sobre WorkStealingDeque: cada worker tem seu deque de
+// tarefas; fork empilha no deque do worker atual e join, enquanto a
+// tarefa não termina, executa outras (primeiro as próprias, depois
+// roubadas de outros workers). Sem nada para roubar, join sonda um pouco
+// e depois dorme até a tarefa terminar ou surgir trabalho novo.
+//
+// Uso (dentro de invoke):
+//     int fib(ForkJoinPool& pool, int n) {
+//         if (n < 2) return n;
+//         auto left = pool.fork([&] { return fib(pool, n - 1); });
+//         int right = fib(pool, n - 2);
+//         return left.join() + right;
+//     }
+//     int result = pool.invoke([&] { return fib(pool, 30); });
+//
+// As tarefas vivem na pilha de quem chamou fork (sem alocação): o objeto
+// retornado não pode ser copiado nem movido, e o destrutor espera a
+// tarefa se join não foi chamado.
+
+class ForkJoinPool;
+
+// Base das tarefas enfileiradas nos deques
+class ForkJoinTaskBase {
+    friend class ForkJoinPool;
+
+protected:
+    std::atomic<bool> finished{false};
+
+    // Executa a tarefa e marca finished (último acesso ao objeto)
+    virtual void run() = 0;
+
+    ~ForkJoinTaskBase() = default;
+
+public:
+    bool done() const { return finished.load(std::memory_order_acquire); }
+};
+
+// Tarefa criada por fork/invoke; F é o tipo do callable
+template<class F>
+class ForkJoinTask : public ForkJoinTaskBase {
+    friend class ForkJoinPool;
+
+public:
+    using Result = std::invoke_result_t<F&>;
+
+private:
+    using Stored = std::conditional_t<std::is_void<Result>::value, bool, Result>;
+
+    ForkJoinPool* pool;
+    F function;
+    std::optional<Stored> result;
+    std::exception_ptr error;
+    bool joined;
+
+    // local = true: empilha no deque do worker atual; false: fila externa do pool
+    template<typename Callable>
+    ForkJoinTask(ForkJoinPool& owner, Callable&& callable, bool local);
+
+    void run() override;
+
+public:
+    ForkJoinTask(const ForkJoinTask&) = delete;
+    ForkJoinTask& operator=(const ForkJoinTask&) = delete;
+
+    // Espera a tarefa se ela não foi juntada (exceções são descartadas)
+    ~ForkJoinTask();
+
+    // Espera a tarefa ajudando o pool; retorna o resultado ou relança a exceção
+    Result join();
+};
+
+class ForkJoinPool {
+    template<class F>
+    friend class ForkJoinTask;
+
+private:
+    struct Worker {
+        WorkStealingDeque<ForkJoinTaskBase*> tasks;
+        std::thread thread;
+    };
+
+    // Worker da thread atual (pool nulo fora dos workers)
+    struct Context {
+        ForkJoinPool* pool;
+        size_t index;
+    };
+
+    static constexpr int idleSpins = 64;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Tarefas de threads externas (invoke) e sono dos workers
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable joinWake;     // Workers dormindo dentro de join
+    std::condition_variable rootFinished;
+    Queue<ForkJoinTaskBase*> submitted;
+    std::atomic<size_t> submittedCount;
+    std::atomic<size_t> sleeping;
+    std::atomic<size_t> joining;          // Quantos esperam em joinWake
+    std::atomic<bool> stopping;
+
+    static Context& current();
+
+    void workerLoop(size_t index);
+
+    // Próprio deque, depois roubo dos outros, depois fila externa
+    // (external indica que a tarefa veio de invoke externo)
+    ForkJoinTaskBase* findTask(size_t index, bool includeSubmitted, bool& external);
+
+    // Há trabalho nos deques (e, com includeSubmitted, na fila externa)?
+    bool hasVisibleWork(bool includeSubmitted = true) const;
+
+    // Executa uma tarefa e acorda quem dorme em join, se houver
+    void execute(ForkJoinTaskBase* task);
+
+    // Empilha no deque do worker atual e acorda um worker dormindo
+    void pushLocal(ForkJoinTaskBase* task);
+
+    // Coloca na fila externa e acorda um worker
+    void submit(ForkJoinTaskBase* task);
+
+    // Executa outras tarefas até task terminar; sem nenhuma, dorme em joinWake
+    void helpUntilDone(const ForkJoinTaskBase& task);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor com número de workers (0 = hardware_concurrency)
+    explicit ForkJoinPool(size_t threads = 0);
+
+    // Destrutor: encerra e junta os workers (sem invoke em andamento)
+    ~ForkJoinPool();
+
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    // ==================== TAREFAS ====================
+
+    // Executa function no pool e retorna seu resultado; dentro de um
+    // worker do próprio pool, executa direto
+    template<typename F>
+    std::invoke_result_t<std::decay_t<F>&> invoke(F&& function);
+
+    // Cria uma subtarefa que outros workers podem roubar (só dentro do pool)
+    template<typename F>
+    ForkJoinTask<std::decay_t<F>> fork(F&& function);
+
+    // ==================== CONSULTA ====================
+
+    size_t workerCount() const;
+
+    // A thread atual é um worker deste pool?
+    bool inWorker() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// ForkJoinTask
+template<class F>
+template<typename Callable>
+ForkJoinTask<F>::ForkJoinTask(ForkJoinPool& owner, Callable&& callable, bool local)
+    : pool(&owner), function(std::forward<Callable>(callable)), joined(false) {
+    if (local) {
+        pool->pushLocal(this);
+    } else {
+        pool->submit(this);
+    }
+}
+
+template<class F>
+void ForkJoinTask<F>::run() {
+    try {
+        if constexpr (std::is_void<Result>::value) {
+            function();
+            result.emplace(true);
+        } else {
+            result.emplace(function());
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    finished.store(true, std::memory_order_release);
+}
+
+template<class F>
+ForkJoinTask<F>::~ForkJoinTask() {
+    if (!joined && !done()) {
+        pool->helpUntilDone(*this);
+    }
+}
+
+template<class F>
+typename ForkJoinTask<F>::Result ForkJoinTask<F>::join() {
+    if (!done()) {
+        pool->helpUntilDone(*this);
+    }
+    joined = true;
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    if constexpr (!std::is_void<Result>::value) {
+        return std::move(*result);
+    }
+}
+
+// ForkJoinPool: construtor
+inline ForkJoinPool::ForkJoinPool(size_t threads)
+    : submittedCount(0), sleeping(0), joining(0), stopping(false) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        workers[i]->thread = std::thread(&ForkJoinPool::workerLoop, this, i);
+    }
+}
+
+// Destrutor
+inline ForkJoinPool::~ForkJoinPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping.store(true, std::memory_order_relaxed);
+    }
+    wakeUp.notify_all();
+    for (std::unique_ptr<Worker>& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+inline ForkJoinPool::Context& ForkJoinPool::current() {
+    static thread_local Context context{nullptr, 0};
+    return context;
+}
+
+// Busca de tarefas
+inline ForkJoinTaskBase* ForkJoinPool::findTask(size_t index, bool includeSubmitted, bool& external) {
+    ForkJoinTaskBase* task = nullptr;
+    external = false;
+
+    if (workers[index]->tasks.pop(task)) {
+        return task;
+    }
+
+    size_t count = workers.size();
+    for (size_t offset = 1; offset < count; ++offset) {
+        if (workers[(index + offset) % count]->tasks.steal(task)) {
+            return task;
+        }
+    }
+
+    if (includeSubmitted && submittedCount.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (submitted.tryDequeue(task)) {
+            submittedCount.store(submitted.size(), std::memory_order_relaxed);
+            external = true;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+// Chamado com o mutex travado
+inline bool ForkJoinPool::hasVisibleWork(bool includeSubmitted) const {
+    if (includeSubmitted && !submitted.empty()) {
+        return true;
+    }
+    for (const std::unique_ptr<Worker>& worker : workers) {
+        if (!worker->tasks.emptyApprox()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Loop dos workers: procura trabalho, sonda um pouco e depois dorme.
+// Antes de dormir, o worker se registra em sleeping e procura de novo;
+// pushLocal empilha e depois lê sleeping (fences seq_cst nos dois lados),
+// então ao menos um dos dois vê o outro e nenhum fork fica sem worker.
+inline void ForkJoinPool::workerLoop(size_t index) {
+    current() = Context{this, index};
+
+    while (!stopping.load(std::memory_order_relaxed)) {
+        bool external = false;
+        ForkJoinTaskBase* task = findTask(index, true, external);
+        for (int spin = 0; task == nullptr && spin < idleSpins; ++spin) {
+            std::this_thread::yield();
+            task = findTask(index, true, external);
+        }
+
+        if (task != nullptr) {
+            execute(task);
+            if (external) {
+                // invoke externo espera em rootFinished
+                std::lock_guard<std::mutex> lock(mutex);
+                rootFinished.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (stopping.load(std::memory_order_relaxed)) {
+            break;
+        }
+        sleeping.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!hasVisibleWork()) {
+            wakeUp.wait(lock);
+        }
+        sleeping.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    current() = Context{nullptr, 0};
+}
+
+inline void ForkJoinPool::pushLocal(ForkJoinTaskBase* task) {
+    workers[current().index]->tasks.push(task);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool idleWorkers = sleeping.load(std::memory_order_relaxed) > 0;
+    bool idleJoiners = joining.load(std::memory_order_relaxed) > 0;
+    if (idleWorkers || idleJoiners) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idleWorkers) {
+            wakeUp.notify_one();
+        }
+        if (idleJoiners) {
+            joinWake.notify_one();
+        }
+    }
+}
+
+inline void ForkJoinPool::submit(ForkJoinTaskBase* task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        submitted.enqueue(task);
+        submittedCount.store(submitted.size(), std::memory_order_release);
+    }
+    wakeUp.notify_one();
+}
+
+// A fence pareia com a de helpUntilDone: quem termina a tarefa vê joining
+// ou o joiner vê finished antes de dormir
+inline void ForkJoinPool::execute(ForkJoinTaskBase* task) {
+    task->run(); // task pode já ter sido destruída depois daqui
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (joining.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        joinWake.notify_all();
+    }
+}
+
+// Join: ajuda com tarefas dos deques (não pega invoke externo, que poderia
+// ser bem maior que a tarefa esperada). Sem nada para roubar, sonda
+// idleSpins vezes e dorme em joinWake, com o mesmo protocolo de workerLoop:
+// registra-se em joining e reconfere a tarefa e os deques antes de esperar.
+// execute acorda os joiners quando qualquer tarefa termina; pushLocal, quando
+// surge trabalho.
+inline void ForkJoinPool::helpUntilDone(const ForkJoinTaskBase& task) {
+    size_t index = current().index;
+    int idle = 0;
+    while (!task.done()) {
+        bool external = false;
+        ForkJoinTaskBase* other = findTask(index, false, external);
+        if (other != nullptr) {
+            execute(other);
+            idle = 0;
+            continue;
+        }
+        if (++idle < idleSpins) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        joining.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!task.done() && !hasVisibleWork(false)) {
+            joinWake.wait(lock);
+        }
+        joining.fetch_sub(1, std::memory_order_relaxed);
+        idle = 0;
+    }
+}
+
+// Tarefas
+template<typename F>
+std::invoke_result_t<std::decay_t<F>&> ForkJoinPool::invoke(F&& function) {
+    if (current().pool == this) {
+        return function();
+    }
+
+    ForkJoinTask<std::decay_t<F>> task(*this, std::forward<F>(function), false);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        rootFinished.wait(lock, [&task] { return task.done(); });
+    }
+    return task.join();
+}
+
+template<typename F>
+ForkJoinTask<std::decay_t<F>> ForkJoinPool::fork(F&& function) {
+    if (current().pool != this) {
+        throw std::logic_error("fork called outside of a ForkJoinPool worker");
+    }
+    return ForkJoinTask<std::decay_t<F>>(*this, std::forward<F>(function), true);
+}
+
+// Consulta
+inline size_t ForkJoinPool::workerCount() const {
+    return workers.size();
+}
+
+inline bool ForkJoinPool::inWorker() const {
+    return current().pool == this;
+}
+
+#endif // FORKJOINPOOL_H
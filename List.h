@@ -8,13 +8,24 @@
 #include <algorithm>
 #include <initializer_list>
 #include <iterator>
-
-template<class T>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <queue>
+#include <random>
+#include <atomic>
+#include "OutputBuffer.h"
+#include "MemoryUsage.h"
+
+// Compare define a ordem usada por isSorted, sort(), insertSorted(),
+// binarySearch(), merge() e operações de conjunto (padrão: operator<)
+template<class T, class Compare = std::less<T>>
 class List {
 private:
-    class Node {
+    class Node : public CountedNode<ContainerKind::List> {
     public:
         T data;
+        uint32_t handleSlot; // Slot na tabela de handles (noHandle se não houver)
         Node* next;
         Node* prev;
         
@@ -26,22 +37,73 @@ private:
         ~Node() = default;
     };
     
+    // Entrada da tabela de handles geracionais
+    struct HandleSlot {
+        Node* node;
+        uint32_t generation;
+        uint32_t nextFree;
+    };
+    
+    static constexpr uint32_t noHandle = UINT32_MAX;
+    
     Node* headNode;
     Node* tailNode;
     size_t listSize;
-    bool isSorted; // Flag para otimizar operações em listas ordenadas
+    bool isSorted; // Flag para otimizar operações em listas ordenadas (segundo order)
+    Compare order; // Ordem da lista (estrita e fraca)
+    
+    std::vector<HandleSlot> handleSlots; // Tabela de handles (vazia se não usada)
+    uint32_t freeHandleSlot;             // Início da lista de slots livres
     
     // Métodos auxiliares privados
     Node* getNodeAt(size_t index) const;
+    Node* lowerBoundNode(const T& value, size_t& index) const; // Primeiro nó não menor que value
+    void destroyNode(Node* node);
+    void releaseHandle(Node* node);
+    Node* handleNode(uint32_t index, uint32_t generation) const;
+    static uint32_t nextHandleGeneration();
+    void writeElements(OutputBuffer& out, size_t previewCount) const;
     void insertAfter(Node* node, Node* newNode);
-    void insertBefore(Node* node, Node* newNode);
-    void removeNode(Node* node);
-    Node* partition(Node* low, Node* high);
-    void quickSortRec(Node* low, Node* high);
-    Node* merge(Node* left, Node* right);
-    Node* mergeSort(Node* head);
+    void insertBefore(Node* node, Node* newNode); // node == nullptr insere no final
+    void removeNode(Node* node);                  // Desliga o nó sem liberá-lo
+    void relinkPrev();
+    // Run ordenado (cadeia simplesmente encadeada terminada em nullptr)
+    struct SortRun {
+        Node* head;
+        Node* tail;
+        size_t length;
+    };
+    
+    // Merge sort natural: aproveita runs existentes, estável e sem recursão
+    template<typename Less>
+    static Node* naturalMergeSort(Node* head, Less less);
+    
+    template<typename Less>
+    static SortRun mergeRuns(SortRun left, SortRun right, Less less);
     size_t getNodeIndex(Node* node) const;
     
+    // Cadeia de nós ainda não ligada à lista (inserção em lote)
+    struct NodeChain {
+        Node* head;
+        Node* tail;
+        size_t length;
+        bool ordered; // Cadeia em ordem segundo order
+    };
+    
+    // Aloca e encadeia os nós de [first, last); libera tudo se uma cópia lançar
+    template<typename InputIt>
+    NodeChain buildChain(InputIt first, InputIt last) const;
+    
+    // Liga a cadeia antes de pos (nullptr = final) e atualiza tamanho e isSorted uma vez
+    void linkChain(Node* pos, const NodeChain& chain);
+    
+    // Passada única de merge para as operações de conjunto
+    void setMerge(List& other, bool keepOnlyThis, bool keepOnlyOther, bool keepCommon);
+    
+    // Converte chave aritmética em inteiro sem sinal com a mesma ordem
+    template<typename K>
+    static uint64_t radixKey(K key);
+    
 public:
     // ==================== ITERADORES ====================
     class Iterator {
@@ -140,10 +202,43 @@ public:
         }
     };
     
+    // ==================== HANDLES ====================
+    // Referência estável de 8 bytes para um elemento (índice + geração).
+    // Continua válida enquanto o elemento existir, mesmo após ordenações;
+    // fica inválida (detectável) quando o elemento é removido.
+    class Handle {
+    private:
+        uint32_t index;
+        uint32_t generation;
+        friend class List;
+        
+        Handle(uint32_t slotIndex, uint32_t slotGeneration) : index(slotIndex), generation(slotGeneration) {}
+        
+    public:
+        Handle() : index(noHandle), generation(0) {}
+        
+        // Representação compacta para uso em estruturas de índice
+        uint64_t raw() const { return (static_cast<uint64_t>(generation) << 32) | index; }
+        static Handle fromRaw(uint64_t value) {
+            return Handle(static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32));
+        }
+        
+        bool operator==(const Handle& other) const {
+            return index == other.index && generation == other.generation;
+        }
+        
+        bool operator!=(const Handle& other) const {
+            return !(*this == other);
+        }
+    };
+    
     // ==================== CONSTRUTORES E DESTRUTOR ====================
     // Construtor padrão
     List();
     
+    // Construtor com comparador (para comparadores com estado)
+    explicit List(const Compare& comparator);
+    
     // Construtor de cópia
     List(const List& other);
     
@@ -156,6 +251,10 @@ public:
     // Construtor com tamanho e valor padrão
     List(size_t count, const T& value = T{});
     
+    // Construtor a partir de intervalo de iteradores
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    List(InputIt first, InputIt last);
+    
     // Destrutor
     ~List();
     
@@ -208,10 +307,35 @@ public:
     template<typename... Args>
     Iterator emplace(Iterator pos, Args&&... args);
     
+    // Inserção em lote: aloca e encadeia todos os nós antes de ligá-los
+    // à lista, atualizando tamanho e isSorted uma única vez.
+    // Retorna iterador para o primeiro elemento inserido (pos se vazio)
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Iterator insert(Iterator pos, InputIt first, InputIt last);
+    Iterator insert(Iterator pos, std::initializer_list<T> init);
+    
+    // Adiciona um intervalo inteiro no final (move os elementos se receber rvalue)
+    template<typename Range>
+    void append(Range&& range);
+    void append(std::initializer_list<T> init);
+    
+    // Substitui o conteúdo
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> init);
+    
     // Inserção ordenada (para listas ordenadas)
     void insertSorted(const T& value);
     void insertSorted(T&& value);
     
+    // Inserção retornando handle estável
+    Handle pushFrontHandle(const T& value);
+    Handle pushFrontHandle(T&& value);
+    Handle pushBackHandle(const T& value);
+    Handle pushBackHandle(T&& value);
+    Handle insertHandle(Iterator pos, const T& value);
+    Handle insertHandle(Iterator pos, T&& value);
+    
     // ==================== MÉTODOS DE REMOÇÃO ====================
     
     // Remove do início
@@ -230,6 +354,9 @@ public:
     Iterator erase(Iterator pos);
     Iterator erase(Iterator first, Iterator last);
     
+    // Remove por handle em O(1); retorna false se o handle for inválido
+    bool erase(Handle handle);
+    
     // Remove primeira ocorrência
     bool removeFirst(const T& value);
     
@@ -257,6 +384,13 @@ public:
     T& back();
     const T& back() const;
     
+    // Acesso por handle em O(1)
+    T& get(Handle handle);
+    const T& get(Handle handle) const;
+    bool valid(Handle handle) const;
+    Handle handleOf(Iterator pos);
+    Iterator iteratorOf(Handle handle);
+    
     // ==================== MÉTODOS DE CONSULTA ====================
     
     // Tamanho e estado
@@ -264,6 +398,9 @@ public:
     bool empty() const;
     bool sorted() const;
     
+    // Memória ocupada: nós, payload, slack do alocador, tabela de handles e DeepSize<T>
+    MemoryUsage memoryUsage() const;
+    
     // Busca linear
     bool contains(const T& value) const;
     size_t count(const T& value) const;
@@ -284,6 +421,23 @@ public:
     void sort();
     void sort(std::function<bool(const T&, const T&)> comparator);
     
+    // Ordenação radix (LSD, estável) religando os nós
+    void radixSort(); // Apenas para T aritmético de até 64 bits (não long double)
+    template<typename KeyExtractor>
+    void radixSort(KeyExtractor keyOf);
+    
+    // Seleção em O(n) esperado (quickselect religando nós)
+    void nthElement(size_t k);       // Posição k recebe o elemento da ordem final
+    void partialSort(size_t k);      // Os k menores ficam no início, ordenados
+    
+    // Move para o início os elementos que satisfazem pred (estável);
+    // retorna iterador para o primeiro que não satisfaz
+    template<typename Predicate>
+    Iterator partition(Predicate pred);
+    
+    // Os k primeiros elementos segundo comparator, em ordem (heap limitado)
+    List topK(size_t k, std::function<bool(const T&, const T&)> comparator) const;
+    
     // Verifica se está ordenada
     bool isSortedCheck() const;
     bool isSortedCheck(std::function<bool(const T&, const T&)> comparator) const;
@@ -292,6 +446,18 @@ public:
     void merge(List& other);
     void merge(List& other, std::function<bool(const T&, const T&)> comparator);
     
+    // ==================== OPERAÇÕES DE CONJUNTO ====================
+    
+    // Operações em listas ordenadas (semântica de multiconjunto, como std::set_*).
+    // Resultado fica nesta lista; os nós de other são reaproveitados e other fica vazia.
+    void setUnion(List& other);
+    void setIntersection(List& other);
+    void setDifference(List& other);
+    void setSymmetricDifference(List& other);
+    
+    // Verifica se todos os elementos de other estão contidos nesta lista
+    bool includes(const List& other) const;
+    
     // ==================== OPERAÇÕES DE MANIPULAÇÃO ====================
     
     // Limpa a lista
@@ -306,7 +472,12 @@ public:
     // Redimensiona
     void resize(size_t newSize, const T& value = T{});
     
-    // Remove duplicatas
+    // Transferência de nós em O(1), sem alocação (apenas religa)
+    void splice(Iterator pos, List& other, Iterator it); // Move *it de other para antes de pos
+    void moveToFront(Iterator it);
+    void moveToBack(Iterator it);
+    
+    // Remove duplicatas consecutivas (equivalentes segundo a ordem Compare)
     void unique();
     void unique(std::function<bool(const T&, const T&)> comparator);
     
@@ -326,7 +497,7 @@ public:
     List<U> map(std::function<U(const T&)> mapper) const;
     
     // Filtro
-    List<T> filter(std::function<bool(const T&)> predicate) const;
+    List filter(std::function<bool(const T&)> predicate) const;
     
     // Redução
     template<typename U>
@@ -349,8 +520,8 @@ public:
     
     // ==================== OPERADOR DE SAÍDA ====================
     
-    template<class U>
-    friend std::ostream& operator<<(std::ostream& os, const List<U>& list);
+    template<class U, class C>
+    friend std::ostream& operator<<(std::ostream& os, const List<U, C>& list);
     
     // ==================== MÉTODOS DE DEBUG ====================
     
@@ -358,6 +529,11 @@ public:
     void print() const;
     void printReverse() const;
     
+    // Escrita bufferizada no formato de operator<<
+    // (previewCount > 0 mostra só os primeiros e últimos previewCount elementos)
+    void writeTo(std::ostream& os, size_t previewCount = 0) const;
+    void writeTo(int fd, size_t previewCount = 0) const;
+    
     // Verifica integridade da estrutura
     bool checkIntegrity() const;
     
@@ -368,95 +544,111 @@ public:
 // ==================== IMPLEMENTAÇÕES INLINE ====================
 
 // Construtores da classe Node
-template<class T>
-List<T>::Node::Node() : next(nullptr), prev(nullptr) {}
+template<class T, class Compare>
+List<T, Compare>::Node::Node() : handleSlot(noHandle), next(nullptr), prev(nullptr) {}
 
-template<class T>
-List<T>::Node::Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+template<class T, class Compare>
+List<T, Compare>::Node::Node(const T& value) : data(value), handleSlot(noHandle), next(nullptr), prev(nullptr) {}
 
-template<class T>
-List<T>::Node::Node(T&& value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+template<class T, class Compare>
+List<T, Compare>::Node::Node(T&& value) : data(std::move(value)), handleSlot(noHandle), next(nullptr), prev(nullptr) {}
 
 // Construtor padrão
-template<class T>
-List<T>::List() : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true) {}
+template<class T, class Compare>
+List<T, Compare>::List() : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true), freeHandleSlot(noHandle) {}
+
+// Construtor com comparador
+template<class T, class Compare>
+List<T, Compare>::List(const Compare& comparator)
+    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true), order(comparator), freeHandleSlot(noHandle) {}
 
 // Construtor de cópia
-template<class T>
-List<T>::List(const List& other) 
-    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(other.isSorted) {
+template<class T, class Compare>
+List<T, Compare>::List(const List& other) 
+    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(other.isSorted), order(other.order), freeHandleSlot(noHandle) {
     *this = other;
 }
 
 // Construtor de movimento
-template<class T>
-List<T>::List(List&& other) noexcept 
-    : headNode(other.headNode), tailNode(other.tailNode), listSize(other.listSize), isSorted(other.isSorted) {
+template<class T, class Compare>
+List<T, Compare>::List(List&& other) noexcept 
+    : headNode(other.headNode), tailNode(other.tailNode), listSize(other.listSize), isSorted(other.isSorted),
+      order(other.order), handleSlots(std::move(other.handleSlots)), freeHandleSlot(other.freeHandleSlot) {
     other.headNode = nullptr;
     other.tailNode = nullptr;
     other.listSize = 0;
     other.isSorted = true;
+    other.handleSlots.clear();
+    other.freeHandleSlot = noHandle;
 }
 
 // Construtor com lista de inicialização
-template<class T>
-List<T>::List(std::initializer_list<T> init) 
-    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true) {
-    for (const auto& item : init) {
-        pushBack(item);
-    }
+template<class T, class Compare>
+List<T, Compare>::List(std::initializer_list<T> init) 
+    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true), freeHandleSlot(noHandle) {
+    linkChain(nullptr, buildChain(init.begin(), init.end()));
+}
+
+// Construtor a partir de intervalo
+template<class T, class Compare>
+template<typename InputIt, typename>
+List<T, Compare>::List(InputIt first, InputIt last)
+    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true), freeHandleSlot(noHandle) {
+    linkChain(nullptr, buildChain(first, last));
 }
 
 // Construtor com tamanho e valor
-template<class T>
-List<T>::List(size_t count, const T& value) 
-    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true) {
+template<class T, class Compare>
+List<T, Compare>::List(size_t count, const T& value) 
+    : headNode(nullptr), tailNode(nullptr), listSize(0), isSorted(true), freeHandleSlot(noHandle) {
     for (size_t i = 0; i < count; ++i) {
         pushBack(value);
     }
 }
 
 // Destrutor
-template<class T>
-List<T>::~List() {
+template<class T, class Compare>
+List<T, Compare>::~List() {
     clear();
 }
 
 // Operador de atribuição por cópia
-template<class T>
-List<T>& List<T>::operator=(const List& other) {
+template<class T, class Compare>
+List<T, Compare>& List<T, Compare>::operator=(const List& other) {
     if (this != &other) {
         clear();
-        Node* current = other.headNode;
-        while (current != nullptr) {
-            pushBack(current->data);
-            current = current->next;
-        }
+        order = other.order;
+        linkChain(nullptr, buildChain(other.begin(), other.end()));
         isSorted = other.isSorted;
     }
     return *this;
 }
 
 // Operador de atribuição por movimento
-template<class T>
-List<T>& List<T>::operator=(List&& other) noexcept {
+template<class T, class Compare>
+List<T, Compare>& List<T, Compare>::operator=(List&& other) noexcept {
     if (this != &other) {
         clear();
         headNode = other.headNode;
         tailNode = other.tailNode;
         listSize = other.listSize;
         isSorted = other.isSorted;
+        order = other.order;
+        handleSlots = std::move(other.handleSlots);
+        freeHandleSlot = other.freeHandleSlot;
         other.headNode = nullptr;
         other.tailNode = nullptr;
         other.listSize = 0;
         other.isSorted = true;
+        other.handleSlots.clear();
+        other.freeHandleSlot = noHandle;
     }
     return *this;
 }
 
 // Método auxiliar para obter nó por índice
-template<class T>
-typename List<T>::Node* List<T>::getNodeAt(size_t index) const {
+template<class T, class Compare>
+typename List<T, Compare>::Node* List<T, Compare>::getNodeAt(size_t index) const {
     if (index >= listSize) {
         throw std::out_of_range("Index out of range");
     }
@@ -477,9 +669,138 @@ typename List<T>::Node* List<T>::getNodeAt(size_t index) const {
     return current;
 }
 
+// Libera o nó e invalida o handle associado, se houver
+template<class T, class Compare>
+void List<T, Compare>::destroyNode(Node* node) {
+    releaseHandle(node);
+    delete node;
+}
+
+// Devolve o slot do handle à lista livre com nova geração
+template<class T, class Compare>
+void List<T, Compare>::releaseHandle(Node* node) {
+    if (node->handleSlot == noHandle) {
+        return;
+    }
+    HandleSlot& slot = handleSlots[node->handleSlot];
+    slot.node = nullptr;
+    slot.generation = nextHandleGeneration();
+    slot.nextFree = freeHandleSlot;
+    freeHandleSlot = node->handleSlot;
+    node->handleSlot = noHandle;
+}
+
+// Resolve handle para nó (nullptr se inválido)
+template<class T, class Compare>
+typename List<T, Compare>::Node* List<T, Compare>::handleNode(uint32_t index, uint32_t generation) const {
+    if (index >= handleSlots.size()) {
+        return nullptr;
+    }
+    const HandleSlot& slot = handleSlots[index];
+    return slot.generation == generation ? slot.node : nullptr;
+}
+
+// Gerações vêm de um contador global: handles de outra lista ou de uma
+// tabela substituída (move, clear) nunca coincidem com handles atuais
+template<class T, class Compare>
+uint32_t List<T, Compare>::nextHandleGeneration() {
+    static std::atomic<uint32_t> counter{1};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Handle of: associa (ou reutiliza) um slot para o nó
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::handleOf(Iterator pos) {
+    Node* node = pos.current;
+    if (node == nullptr) {
+        throw std::out_of_range("Invalid iterator");
+    }
+    
+    if (node->handleSlot == noHandle) {
+        uint32_t index;
+        if (freeHandleSlot != noHandle) {
+            index = freeHandleSlot;
+            freeHandleSlot = handleSlots[index].nextFree;
+        } else {
+            if (handleSlots.size() >= noHandle) {
+                throw std::length_error("Too many handles");
+            }
+            index = static_cast<uint32_t>(handleSlots.size());
+            handleSlots.push_back({nullptr, nextHandleGeneration(), noHandle});
+        }
+        handleSlots[index].node = node;
+        node->handleSlot = index;
+    }
+    
+    return Handle(node->handleSlot, handleSlots[node->handleSlot].generation);
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::iteratorOf(Handle handle) {
+    return Iterator(handleNode(handle.index, handle.generation));
+}
+
+template<class T, class Compare>
+bool List<T, Compare>::valid(Handle handle) const {
+    return handleNode(handle.index, handle.generation) != nullptr;
+}
+
+template<class T, class Compare>
+T& List<T, Compare>::get(Handle handle) {
+    Node* node = handleNode(handle.index, handle.generation);
+    if (node == nullptr) {
+        throw std::out_of_range("Invalid handle");
+    }
+    return node->data;
+}
+
+template<class T, class Compare>
+const T& List<T, Compare>::get(Handle handle) const {
+    Node* node = handleNode(handle.index, handle.generation);
+    if (node == nullptr) {
+        throw std::out_of_range("Invalid handle");
+    }
+    return node->data;
+}
+
+// Inserção com handle
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::pushFrontHandle(const T& value) {
+    pushFront(value);
+    return handleOf(begin());
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::pushFrontHandle(T&& value) {
+    pushFront(std::move(value));
+    return handleOf(begin());
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::pushBackHandle(const T& value) {
+    pushBack(value);
+    return handleOf(rbegin());
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::pushBackHandle(T&& value) {
+    pushBack(std::move(value));
+    return handleOf(rbegin());
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::insertHandle(Iterator pos, const T& value) {
+    return handleOf(insert(pos, value));
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Handle List<T, Compare>::insertHandle(Iterator pos, T&& value) {
+    return handleOf(insert(pos, std::move(value)));
+}
+
 // Push front
-template<class T>
-void List<T>::pushFront(const T& value) {
+template<class T, class Compare>
+void List<T, Compare>::pushFront(const T& value) {
     Node* newNode = new Node(value);
     
     if (empty()) {
@@ -490,15 +811,15 @@ void List<T>::pushFront(const T& value) {
         headNode = newNode;
         
         // Verifica se ainda está ordenada
-        if (isSorted && listSize > 0 && value > newNode->next->data) {
+        if (isSorted && listSize > 0 && order(newNode->next->data, value)) {
             isSorted = false;
         }
     }
     ++listSize;
 }
 
-template<class T>
-void List<T>::pushFront(T&& value) {
+template<class T, class Compare>
+void List<T, Compare>::pushFront(T&& value) {
     Node* newNode = new Node(std::move(value));
     
     if (empty()) {
@@ -509,7 +830,7 @@ void List<T>::pushFront(T&& value) {
         headNode = newNode;
         
         // Verifica se ainda está ordenada
-        if (isSorted && listSize > 0 && newNode->data > newNode->next->data) {
+        if (isSorted && listSize > 0 && order(newNode->next->data, newNode->data)) {
             isSorted = false;
         }
     }
@@ -517,8 +838,8 @@ void List<T>::pushFront(T&& value) {
 }
 
 // Push back
-template<class T>
-void List<T>::pushBack(const T& value) {
+template<class T, class Compare>
+void List<T, Compare>::pushBack(const T& value) {
     Node* newNode = new Node(value);
     
     if (empty()) {
@@ -529,15 +850,15 @@ void List<T>::pushBack(const T& value) {
         tailNode = newNode;
         
         // Verifica se ainda está ordenada
-        if (isSorted && listSize > 0 && value < newNode->prev->data) {
+        if (isSorted && listSize > 0 && order(value, newNode->prev->data)) {
             isSorted = false;
         }
     }
     ++listSize;
 }
 
-template<class T>
-void List<T>::pushBack(T&& value) {
+template<class T, class Compare>
+void List<T, Compare>::pushBack(T&& value) {
     Node* newNode = new Node(std::move(value));
     
     if (empty()) {
@@ -548,7 +869,7 @@ void List<T>::pushBack(T&& value) {
         tailNode = newNode;
         
         // Verifica se ainda está ordenada
-        if (isSorted && listSize > 0 && newNode->data < newNode->prev->data) {
+        if (isSorted && listSize > 0 && order(newNode->data, newNode->prev->data)) {
             isSorted = false;
         }
     }
@@ -556,8 +877,8 @@ void List<T>::pushBack(T&& value) {
 }
 
 // Insert por índice
-template<class T>
-void List<T>::insert(size_t index, const T& value) {
+template<class T, class Compare>
+void List<T, Compare>::insert(size_t index, const T& value) {
     if (index > listSize) {
         throw std::out_of_range("Index out of range");
     }
@@ -580,8 +901,8 @@ void List<T>::insert(size_t index, const T& value) {
     }
 }
 
-template<class T>
-void List<T>::insert(size_t index, T&& value) {
+template<class T, class Compare>
+void List<T, Compare>::insert(size_t index, T&& value) {
     if (index > listSize) {
         throw std::out_of_range("Index out of range");
     }
@@ -605,8 +926,8 @@ void List<T>::insert(size_t index, T&& value) {
 }
 
 // Insert por iterador
-template<class T>
-typename List<T>::Iterator List<T>::insert(Iterator pos, const T& value) {
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::insert(Iterator pos, const T& value) {
     if (pos.current == nullptr) {
         pushBack(value);
         return Iterator(tailNode);
@@ -631,8 +952,8 @@ typename List<T>::Iterator List<T>::insert(Iterator pos, const T& value) {
     return Iterator(newNode);
 }
 
-template<class T>
-typename List<T>::Iterator List<T>::insert(Iterator pos, T&& value) {
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::insert(Iterator pos, T&& value) {
     if (pos.current == nullptr) {
         pushBack(std::move(value));
         return Iterator(tailNode);
@@ -657,10 +978,120 @@ typename List<T>::Iterator List<T>::insert(Iterator pos, T&& value) {
     return Iterator(newNode);
 }
 
+// Build chain: encadeia em passada única, verificando a ordem de passagem
+template<class T, class Compare>
+template<typename InputIt>
+typename List<T, Compare>::NodeChain List<T, Compare>::buildChain(InputIt first, InputIt last) const {
+    NodeChain chain{nullptr, nullptr, 0, true};
+    
+    try {
+        for (; first != last; ++first) {
+            Node* newNode = new Node(*first);
+            if (chain.tail == nullptr) {
+                chain.head = newNode;
+            } else {
+                chain.tail->next = newNode;
+                newNode->prev = chain.tail;
+                if (chain.ordered && order(newNode->data, chain.tail->data)) {
+                    chain.ordered = false;
+                }
+            }
+            chain.tail = newNode;
+            ++chain.length;
+        }
+    } catch (...) {
+        while (chain.head != nullptr) {
+            Node* next = chain.head->next;
+            delete chain.head;
+            chain.head = next;
+        }
+        throw;
+    }
+    
+    return chain;
+}
+
+// Link chain: só as fronteiras da cadeia precisam ser comparadas
+template<class T, class Compare>
+void List<T, Compare>::linkChain(Node* pos, const NodeChain& chain) {
+    if (chain.length == 0) {
+        return;
+    }
+    
+    Node* before = (pos == nullptr) ? tailNode : pos->prev;
+    
+    if (isSorted) {
+        isSorted = chain.ordered &&
+                   (before == nullptr || !order(chain.head->data, before->data)) &&
+                   (pos == nullptr || !order(pos->data, chain.tail->data));
+    }
+    
+    chain.head->prev = before;
+    chain.tail->next = pos;
+    if (before == nullptr) {
+        headNode = chain.head;
+    } else {
+        before->next = chain.head;
+    }
+    if (pos == nullptr) {
+        tailNode = chain.tail;
+    } else {
+        pos->prev = chain.tail;
+    }
+    
+    listSize += chain.length;
+}
+
+// Insert em lote
+template<class T, class Compare>
+template<typename InputIt, typename>
+typename List<T, Compare>::Iterator List<T, Compare>::insert(Iterator pos, InputIt first, InputIt last) {
+    NodeChain chain = buildChain(first, last);
+    linkChain(pos.current, chain);
+    return chain.length == 0 ? pos : Iterator(chain.head);
+}
+
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::insert(Iterator pos, std::initializer_list<T> init) {
+    return insert(pos, init.begin(), init.end());
+}
+
+// Append
+template<class T, class Compare>
+template<typename Range>
+void List<T, Compare>::append(Range&& range) {
+    using std::begin;
+    using std::end;
+    if constexpr (std::is_rvalue_reference<Range&&>::value) {
+        linkChain(nullptr, buildChain(std::make_move_iterator(begin(range)), std::make_move_iterator(end(range))));
+    } else {
+        linkChain(nullptr, buildChain(begin(range), end(range)));
+    }
+}
+
+template<class T, class Compare>
+void List<T, Compare>::append(std::initializer_list<T> init) {
+    linkChain(nullptr, buildChain(init.begin(), init.end()));
+}
+
+// Assign: monta a cadeia antes de limpar (a lista fica intacta se uma cópia lançar)
+template<class T, class Compare>
+template<typename InputIt, typename>
+void List<T, Compare>::assign(InputIt first, InputIt last) {
+    NodeChain chain = buildChain(first, last);
+    clear();
+    linkChain(nullptr, chain);
+}
+
+template<class T, class Compare>
+void List<T, Compare>::assign(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+}
+
 // Emplace methods
-template<class T>
+template<class T, class Compare>
 template<typename... Args>
-void List<T>::emplaceFront(Args&&... args) {
+void List<T, Compare>::emplaceFront(Args&&... args) {
     Node* newNode = new Node();
     newNode->data = T(std::forward<Args>(args)...);
     
@@ -671,16 +1102,16 @@ void List<T>::emplaceFront(Args&&... args) {
         headNode->prev = newNode;
         headNode = newNode;
         
-        if (isSorted && listSize > 0 && newNode->data > newNode->next->data) {
+        if (isSorted && listSize > 0 && order(newNode->next->data, newNode->data)) {
             isSorted = false;
         }
     }
     ++listSize;
 }
 
-template<class T>
+template<class T, class Compare>
 template<typename... Args>
-void List<T>::emplaceBack(Args&&... args) {
+void List<T, Compare>::emplaceBack(Args&&... args) {
     Node* newNode = new Node();
     newNode->data = T(std::forward<Args>(args)...);
     
@@ -691,16 +1122,16 @@ void List<T>::emplaceBack(Args&&... args) {
         newNode->prev = tailNode;
         tailNode = newNode;
         
-        if (isSorted && listSize > 0 && newNode->data < newNode->prev->data) {
+        if (isSorted && listSize > 0 && order(newNode->data, newNode->prev->data)) {
             isSorted = false;
         }
     }
     ++listSize;
 }
 
-template<class T>
+template<class T, class Compare>
 template<typename... Args>
-typename List<T>::Iterator List<T>::emplace(Iterator pos, Args&&... args) {
+typename List<T, Compare>::Iterator List<T, Compare>::emplace(Iterator pos, Args&&... args) {
     Node* newNode = new Node();
     newNode->data = T(std::forward<Args>(args)...);
     
@@ -731,24 +1162,24 @@ typename List<T>::Iterator List<T>::emplace(Iterator pos, Args&&... args) {
 }
 
 // Insert sorted
-template<class T>
-void List<T>::insertSorted(const T& value) {
+template<class T, class Compare>
+void List<T, Compare>::insertSorted(const T& value) {
     if (!isSorted) {
         sort();
     }
     
-    if (empty() || value <= headNode->data) {
+    if (empty() || !order(headNode->data, value)) {
         pushFront(value);
         return;
     }
     
-    if (value >= tailNode->data) {
+    if (!order(value, tailNode->data)) {
         pushBack(value);
         return;
     }
     
     Node* current = headNode;
-    while (current != nullptr && current->data < value) {
+    while (current != nullptr && order(current->data, value)) {
         current = current->next;
     }
     
@@ -762,24 +1193,24 @@ void List<T>::insertSorted(const T& value) {
     // Mantém isSorted = true pois inserimos ordenadamente
 }
 
-template<class T>
-void List<T>::insertSorted(T&& value) {
+template<class T, class Compare>
+void List<T, Compare>::insertSorted(T&& value) {
     if (!isSorted) {
         sort();
     }
     
-    if (empty() || value <= headNode->data) {
+    if (empty() || !order(headNode->data, value)) {
         pushFront(std::move(value));
         return;
     }
     
-    if (value >= tailNode->data) {
+    if (!order(value, tailNode->data)) {
         pushBack(std::move(value));
         return;
     }
     
     Node* current = headNode;
-    while (current != nullptr && current->data < value) {
+    while (current != nullptr && order(current->data, value)) {
         current = current->next;
     }
     
@@ -793,8 +1224,8 @@ void List<T>::insertSorted(T&& value) {
 }
 
 // Pop front
-template<class T>
-void List<T>::popFront() {
+template<class T, class Compare>
+void List<T, Compare>::popFront() {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
@@ -808,12 +1239,12 @@ void List<T>::popFront() {
         headNode->prev = nullptr;
     }
     
-    delete temp;
+    destroyNode(temp);
     --listSize;
 }
 
-template<class T>
-T List<T>::popFrontAndReturn() {
+template<class T, class Compare>
+T List<T, Compare>::popFrontAndReturn() {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
@@ -824,8 +1255,8 @@ T List<T>::popFrontAndReturn() {
 }
 
 // Pop back
-template<class T>
-void List<T>::popBack() {
+template<class T, class Compare>
+void List<T, Compare>::popBack() {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
@@ -839,12 +1270,12 @@ void List<T>::popBack() {
         tailNode->next = nullptr;
     }
     
-    delete temp;
+    destroyNode(temp);
     --listSize;
 }
 
-template<class T>
-T List<T>::popBackAndReturn() {
+template<class T, class Compare>
+T List<T, Compare>::popBackAndReturn() {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
@@ -855,8 +1286,8 @@ T List<T>::popBackAndReturn() {
 }
 
 // Remove at
-template<class T>
-void List<T>::removeAt(size_t index) {
+template<class T, class Compare>
+void List<T, Compare>::removeAt(size_t index) {
     if (index >= listSize) {
         throw std::out_of_range("Index out of range");
     }
@@ -869,13 +1300,13 @@ void List<T>::removeAt(size_t index) {
         Node* nodeToRemove = getNodeAt(index);
         nodeToRemove->prev->next = nodeToRemove->next;
         nodeToRemove->next->prev = nodeToRemove->prev;
-        delete nodeToRemove;
+        destroyNode(nodeToRemove);
         --listSize;
     }
 }
 
-template<class T>
-T List<T>::removeAtAndReturn(size_t index) {
+template<class T, class Compare>
+T List<T, Compare>::removeAtAndReturn(size_t index) {
     if (index >= listSize) {
         throw std::out_of_range("Index out of range");
     }
@@ -886,8 +1317,8 @@ T List<T>::removeAtAndReturn(size_t index) {
 }
 
 // Erase
-template<class T>
-typename List<T>::Iterator List<T>::erase(Iterator pos) {
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::erase(Iterator pos) {
     if (pos.current == nullptr) {
         return end();
     }
@@ -908,23 +1339,33 @@ typename List<T>::Iterator List<T>::erase(Iterator pos) {
         nodeToRemove->next->prev = nodeToRemove->prev;
     }
     
-    delete nodeToRemove;
+    destroyNode(nodeToRemove);
     --listSize;
     
     return Iterator(nextNode);
 }
 
-template<class T>
-typename List<T>::Iterator List<T>::erase(Iterator first, Iterator last) {
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::erase(Iterator first, Iterator last) {
     while (first != last) {
         first = erase(first);
     }
     return last;
 }
 
+template<class T, class Compare>
+bool List<T, Compare>::erase(Handle handle) {
+    Node* node = handleNode(handle.index, handle.generation);
+    if (node == nullptr) {
+        return false;
+    }
+    erase(Iterator(node));
+    return true;
+}
+
 // Remove first/last/all
-template<class T>
-bool List<T>::removeFirst(const T& value) {
+template<class T, class Compare>
+bool List<T, Compare>::removeFirst(const T& value) {
     Node* current = headNode;
     while (current != nullptr) {
         if (current->data == value) {
@@ -940,7 +1381,7 @@ bool List<T>::removeFirst(const T& value) {
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
             }
-            delete current;
+            destroyNode(current);
             --listSize;
             return true;
         }
@@ -949,8 +1390,8 @@ bool List<T>::removeFirst(const T& value) {
     return false;
 }
 
-template<class T>
-bool List<T>::removeLast(const T& value) {
+template<class T, class Compare>
+bool List<T, Compare>::removeLast(const T& value) {
     Node* current = tailNode;
     while (current != nullptr) {
         if (current->data == value) {
@@ -966,7 +1407,7 @@ bool List<T>::removeLast(const T& value) {
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
             }
-            delete current;
+            destroyNode(current);
             --listSize;
             return true;
         }
@@ -975,8 +1416,8 @@ bool List<T>::removeLast(const T& value) {
     return false;
 }
 
-template<class T>
-size_t List<T>::removeAll(const T& value) {
+template<class T, class Compare>
+size_t List<T, Compare>::removeAll(const T& value) {
     size_t removed = 0;
     Node* current = headNode;
     
@@ -995,7 +1436,7 @@ size_t List<T>::removeAll(const T& value) {
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
             }
-            delete current;
+            destroyNode(current);
             --listSize;
             ++removed;
         }
@@ -1006,9 +1447,9 @@ size_t List<T>::removeAll(const T& value) {
 }
 
 // Remove if
-template<class T>
+template<class T, class Compare>
 template<typename Predicate>
-size_t List<T>::removeIf(Predicate pred) {
+size_t List<T, Compare>::removeIf(Predicate pred) {
     size_t removed = 0;
     Node* current = headNode;
     
@@ -1027,7 +1468,7 @@ size_t List<T>::removeIf(Predicate pred) {
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
             }
-            delete current;
+            destroyNode(current);
             --listSize;
             ++removed;
         }
@@ -1038,52 +1479,52 @@ size_t List<T>::removeIf(Predicate pred) {
 }
 
 // Access methods
-template<class T>
-T& List<T>::at(size_t index) {
+template<class T, class Compare>
+T& List<T, Compare>::at(size_t index) {
     return getNodeAt(index)->data;
 }
 
-template<class T>
-const T& List<T>::at(size_t index) const {
+template<class T, class Compare>
+const T& List<T, Compare>::at(size_t index) const {
     return getNodeAt(index)->data;
 }
 
-template<class T>
-T& List<T>::operator[](size_t index) {
+template<class T, class Compare>
+T& List<T, Compare>::operator[](size_t index) {
     return at(index);
 }
 
-template<class T>
-const T& List<T>::operator[](size_t index) const {
+template<class T, class Compare>
+const T& List<T, Compare>::operator[](size_t index) const {
     return at(index);
 }
 
-template<class T>
-T& List<T>::front() {
+template<class T, class Compare>
+T& List<T, Compare>::front() {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
     return headNode->data;
 }
 
-template<class T>
-const T& List<T>::front() const {
+template<class T, class Compare>
+const T& List<T, Compare>::front() const {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
     return headNode->data;
 }
 
-template<class T>
-T& List<T>::back() {
+template<class T, class Compare>
+T& List<T, Compare>::back() {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
     return tailNode->data;
 }
 
-template<class T>
-const T& List<T>::back() const {
+template<class T, class Compare>
+const T& List<T, Compare>::back() const {
     if (empty()) {
         throw std::underflow_error("List is empty");
     }
@@ -1091,24 +1532,43 @@ const T& List<T>::back() const {
 }
 
 // Query methods
-template<class T>
-size_t List<T>::size() const {
+template<class T, class Compare>
+size_t List<T, Compare>::size() const {
     return listSize;
 }
 
-template<class T>
-bool List<T>::empty() const {
+template<class T, class Compare>
+bool List<T, Compare>::empty() const {
     return listSize == 0;
 }
 
-template<class T>
-bool List<T>::sorted() const {
+template<class T, class Compare>
+bool List<T, Compare>::sorted() const {
     return isSorted;
 }
 
+// Memory usage (percorre os elementos só se DeepSize<T> for indireto)
+template<class T, class Compare>
+MemoryUsage List<T, Compare>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    usage.nodeBytes = listSize * sizeof(Node);
+    usage.payloadBytes = listSize * sizeof(T);
+    usage.slackBytes = listSize * allocationSlack(sizeof(Node));
+    if (handleSlots.capacity() > 0) {
+        usage.overheadBytes = allocationSize(handleSlots.capacity() * sizeof(HandleSlot));
+    }
+    if (DeepSize<T>::indirect) {
+        for (Node* current = headNode; current != nullptr; current = current->next) {
+            usage.deepBytes += DeepSize<T>::of(current->data);
+        }
+    }
+    return usage;
+}
+
 // Linear search
-template<class T>
-bool List<T>::contains(const T& value) const {
+template<class T, class Compare>
+bool List<T, Compare>::contains(const T& value) const {
     Node* current = headNode;
     while (current != nullptr) {
         if (current->data == value) {
@@ -1119,8 +1579,8 @@ bool List<T>::contains(const T& value) const {
     return false;
 }
 
-template<class T>
-size_t List<T>::count(const T& value) const {
+template<class T, class Compare>
+size_t List<T, Compare>::count(const T& value) const {
     size_t counter = 0;
     Node* current = headNode;
     while (current != nullptr) {
@@ -1132,8 +1592,8 @@ size_t List<T>::count(const T& value) const {
     return counter;
 }
 
-template<class T>
-int List<T>::findFirst(const T& value) const {
+template<class T, class Compare>
+int List<T, Compare>::findFirst(const T& value) const {
     Node* current = headNode;
     int index = 0;
     while (current != nullptr) {
@@ -1146,8 +1606,8 @@ int List<T>::findFirst(const T& value) const {
     return -1;
 }
 
-template<class T>
-int List<T>::findLast(const T& value) const {
+template<class T, class Compare>
+int List<T, Compare>::findLast(const T& value) const {
     Node* current = tailNode;
     int index = listSize - 1;
     while (current != nullptr) {
@@ -1160,8 +1620,8 @@ int List<T>::findLast(const T& value) const {
     return -1;
 }
 
-template<class T>
-typename List<T>::Iterator List<T>::find(const T& value) {
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::find(const T& value) {
     Node* current = headNode;
     while (current != nullptr) {
         if (current->data == value) {
@@ -1172,8 +1632,8 @@ typename List<T>::Iterator List<T>::find(const T& value) {
     return end();
 }
 
-template<class T>
-typename List<T>::ConstIterator List<T>::find(const T& value) const {
+template<class T, class Compare>
+typename List<T, Compare>::ConstIterator List<T, Compare>::find(const T& value) const {
     Node* current = headNode;
     while (current != nullptr) {
         if (current->data == value) {
@@ -1184,194 +1644,556 @@ typename List<T>::ConstIterator List<T>::find(const T& value) const {
     return end();
 }
 
-// Binary search (apenas para listas ordenadas)
-template<class T>
-bool List<T>::binarySearch(const T& value) const {
-    if (!isSorted) {
-        throw std::logic_error("List must be sorted for binary search");
-    }
-    
-    if (empty()) {
-        return false;
-    }
-    
-    size_t left = 0;
-    size_t right = listSize - 1;
+// Lower bound: bisecção sobre ponteiros; O(log n) comparações e O(n) passos,
+// sem copiar elementos
+template<class T, class Compare>
+typename List<T, Compare>::Node* List<T, Compare>::lowerBoundNode(const T& value, size_t& index) const {
+    Node* first = headNode;
+    size_t count = listSize;
+    index = 0;
     
-    while (left <= right) {
-        size_t mid = left + (right - left) / 2;
-        T midValue = at(mid);
+    while (count > 0) {
+        size_t step = count / 2;
+        Node* mid = first;
+        for (size_t i = 0; i < step; ++i) {
+            mid = mid->next;
+        }
         
-        if (midValue == value) {
-            return true;
-        } else if (midValue < value) {
-            left = mid + 1;
+        if (order(mid->data, value)) {
+            first = mid->next;
+            index += step + 1;
+            count -= step + 1;
         } else {
-            if (mid == 0) break;
-            right = mid - 1;
+            count = step;
         }
     }
     
-    return false;
+    return first;
+}
+
+// Binary search (apenas para listas ordenadas); encontra elemento equivalente segundo order
+template<class T, class Compare>
+bool List<T, Compare>::binarySearch(const T& value) const {
+    return binarySearchIndex(value) != -1;
 }
 
-template<class T>
-int List<T>::binarySearchIndex(const T& value) const {
+template<class T, class Compare>
+int List<T, Compare>::binarySearchIndex(const T& value) const {
     if (!isSorted) {
         throw std::logic_error("List must be sorted for binary search");
     }
     
-    if (empty()) {
+    size_t index;
+    Node* found = lowerBoundNode(value, index);
+    if (found == nullptr || order(value, found->data)) {
         return -1;
     }
-    
-    size_t left = 0;
-    size_t right = listSize - 1;
-    
-    while (left <= right) {
-        size_t mid = left + (right - left) / 2;
-        T midValue = at(mid);
-        
-        if (midValue == value) {
-            return static_cast<int>(mid);
-        } else if (midValue < value) {
-            left = mid + 1;
-        } else {
-            if (mid == 0) break;
-            right = mid - 1;
-        }
-    }
-    
-    return -1;
+    return static_cast<int>(index);
 }
 
-template<class T>
-typename List<T>::Iterator List<T>::binaryFind(const T& value) {
-    int index = binarySearchIndex(value);
-    if (index == -1) {
+template<class T, class Compare>
+typename List<T, Compare>::Iterator List<T, Compare>::binaryFind(const T& value) {
+    if (!isSorted) {
+        throw std::logic_error("List must be sorted for binary search");
+    }
+    
+    size_t index;
+    Node* found = lowerBoundNode(value, index);
+    if (found == nullptr || order(value, found->data)) {
         return end();
     }
-    return Iterator(getNodeAt(index));
+    return Iterator(found);
 }
 
-template<class T>
-typename List<T>::ConstIterator List<T>::binaryFind(const T& value) const {
-    int index = binarySearchIndex(value);
-    if (index == -1) {
+template<class T, class Compare>
+typename List<T, Compare>::ConstIterator List<T, Compare>::binaryFind(const T& value) const {
+    if (!isSorted) {
+        throw std::logic_error("List must be sorted for binary search");
+    }
+    
+    size_t index;
+    Node* found = lowerBoundNode(value, index);
+    if (found == nullptr || order(value, found->data)) {
         return end();
     }
-    return ConstIterator(getNodeAt(index));
+    return ConstIterator(found);
 }
 
 // Sort methods
-template<class T>
-void List<T>::sort() {
+template<class T, class Compare>
+void List<T, Compare>::sort() {
     if (listSize <= 1) {
         isSorted = true;
         return;
     }
     
-    headNode = mergeSort(headNode);
+    headNode = naturalMergeSort(headNode, order);
+    relinkPrev();
     
-    // Reconstrói o tailNode e links prev
-    tailNode = headNode;
+    isSorted = true;
+}
+
+template<class T, class Compare>
+void List<T, Compare>::sort(std::function<bool(const T&, const T&)> comparator) {
+    if (listSize <= 1) {
+        isSorted = false; // Não sabemos se está ordenada com comparador customizado
+        return;
+    }
+    
+    // Religa os nós: não copia T e mantém handles válidos
+    headNode = naturalMergeSort(headNode, comparator);
+    relinkPrev();
+    
+    isSorted = false; // Não sabemos se está ordenada com comparador padrão
+}
+
+// Chave radix: inverte o bit de sinal de inteiros e trata o padrão IEEE 754
+template<class T, class Compare>
+template<typename K>
+uint64_t List<T, Compare>::radixKey(K key) {
+    static_assert(std::is_arithmetic<K>::value, "radixSort requires an arithmetic key");
+    // long double (80/128 bits) não cabe em 64 bits sem perder a ordem
+    static_assert(sizeof(K) <= sizeof(uint64_t), "radixSort requires a key of at most 64 bits; use sort() for long double");
+    
+    if constexpr (std::is_floating_point<K>::value) {
+        if constexpr (sizeof(K) == sizeof(uint32_t)) {
+            uint32_t bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        } else {
+            uint64_t bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+        }
+    } else if constexpr (std::is_signed<K>::value) {
+        using U = typename std::make_unsigned<K>::type;
+        return static_cast<uint64_t>(static_cast<U>(key)) ^ (uint64_t(1) << (sizeof(K) * 8 - 1));
+    } else {
+        return static_cast<uint64_t>(key);
+    }
+}
+
+template<class T, class Compare>
+void List<T, Compare>::radixSort() {
+    radixSort([](const T& value) { return value; });
+    isSorted = std::is_same<Compare, std::less<T>>::value; // Radix produz ordem crescente
+}
+
+// Radix sort LSD: distribui os nós em 256 baldes por byte e concatena
+template<class T, class Compare>
+template<typename KeyExtractor>
+void List<T, Compare>::radixSort(KeyExtractor keyOf) {
+    if (listSize <= 1) {
+        isSorted = false; // Ordenação por chave, não por operator<
+        return;
+    }
+    
+    // Bytes iguais em todas as chaves não precisam de passada
+    uint64_t allOnes = ~uint64_t(0);
+    uint64_t anyOnes = 0;
     Node* current = headNode;
+    while (current != nullptr) {
+        uint64_t key = radixKey(keyOf(current->data));
+        allOnes &= key;
+        anyOnes |= key;
+        current = current->next;
+    }
+    uint64_t varyingBits = allOnes ^ anyOnes;
+    
+    Node* bucketHead[256];
+    Node* bucketTail[256];
+    
+    for (unsigned shift = 0; shift < 64; shift += 8) {
+        if (((varyingBits >> shift) & 0xFF) == 0) {
+            continue;
+        }
+        
+        std::fill(bucketHead, bucketHead + 256, nullptr);
+        
+        current = headNode;
+        while (current != nullptr) {
+            Node* next = current->next;
+            unsigned bucket = static_cast<unsigned>((radixKey(keyOf(current->data)) >> shift) & 0xFF);
+            if (bucketHead[bucket] == nullptr) {
+                bucketHead[bucket] = current;
+            } else {
+                bucketTail[bucket]->next = current;
+            }
+            bucketTail[bucket] = current;
+            current = next;
+        }
+        
+        // Concatena os baldes preservando a ordem (estabilidade)
+        Node* last = nullptr;
+        for (unsigned bucket = 0; bucket < 256; ++bucket) {
+            if (bucketHead[bucket] == nullptr) {
+                continue;
+            }
+            if (last == nullptr) {
+                headNode = bucketHead[bucket];
+            } else {
+                last->next = bucketHead[bucket];
+            }
+            last = bucketTail[bucket];
+        }
+        last->next = nullptr;
+    }
+    
+    // Reconstrói o tailNode e links prev
+    current = headNode;
     current->prev = nullptr;
+    while (current->next != nullptr) {
+        current->next->prev = current;
+        current = current->next;
+    }
+    tailNode = current;
     
+    isSorted = false; // Ordenação por chave, não por operator<
+}
+
+// Reconstrói links prev e tailNode a partir dos links next
+template<class T, class Compare>
+void List<T, Compare>::relinkPrev() {
+    if (headNode == nullptr) {
+        tailNode = nullptr;
+        return;
+    }
+    Node* current = headNode;
+    current->prev = nullptr;
     while (current->next != nullptr) {
         current->next->prev = current;
         current = current->next;
-        tailNode = current;
+    }
+    tailNode = current;
+}
+
+// Nth element: divide a cadeia ativa em menores/iguais/maiores que o pivô
+// e continua apenas na parte que contém a posição k
+template<class T, class Compare>
+void List<T, Compare>::nthElement(size_t k) {
+    if (k >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (isSorted) {
+        return;
     }
     
-    isSorted = true;
+    struct Chain {
+        Node* head = nullptr;
+        Node* tail = nullptr;
+        size_t size = 0;
+        
+        void append(Node* node) {
+            if (tail == nullptr) head = node; else tail->next = node;
+            tail = node;
+            ++size;
+        }
+        
+        void appendChain(const Chain& other) {
+            if (other.head == nullptr) return;
+            if (tail == nullptr) head = other.head; else tail->next = other.head;
+            tail = other.tail;
+            size += other.size;
+        }
+    };
+    
+    static thread_local std::minstd_rand rng(std::random_device{}());
+    
+    Chain prefix;  // Elementos já posicionados antes da parte ativa
+    Chain suffix;  // Elementos já posicionados depois da parte ativa
+    Chain active;
+    active.head = headNode;
+    active.tail = tailNode;
+    active.size = listSize;
+    
+    while (true) {
+        active.tail->next = nullptr;
+        
+        Node* pivot = active.head;
+        for (size_t steps = rng() % active.size; steps > 0; --steps) {
+            pivot = pivot->next;
+        }
+        
+        Chain less, equal, greater;
+        Node* current = active.head;
+        while (current != nullptr) {
+            Node* next = current->next;
+            if (order(current->data, pivot->data)) {
+                less.append(current);
+            } else if (order(pivot->data, current->data)) {
+                greater.append(current);
+            } else {
+                equal.append(current);
+            }
+            current = next;
+        }
+        
+        if (k < less.size) {
+            equal.appendChain(greater);
+            equal.appendChain(suffix);
+            suffix = equal;
+            active = less;
+        } else if (k < less.size + equal.size) {
+            prefix.appendChain(less);
+            prefix.appendChain(equal);
+            prefix.appendChain(greater);
+            prefix.appendChain(suffix);
+            break;
+        } else {
+            k -= less.size + equal.size;
+            prefix.appendChain(less);
+            prefix.appendChain(equal);
+            active = greater;
+        }
+    }
+    
+    prefix.tail->next = nullptr;
+    headNode = prefix.head;
+    relinkPrev();
+    isSorted = false;
 }
 
-template<class T>
-void List<T>::sort(std::function<bool(const T&, const T&)> comparator) {
-    if (listSize <= 1) {
-        isSorted = false; // Não sabemos se está ordenada com comparador customizado
+// Partial sort: seleciona os k menores e ordena só esse prefixo
+template<class T, class Compare>
+void List<T, Compare>::partialSort(size_t k) {
+    if (k >= listSize) {
+        sort();
         return;
     }
+    if (k == 0 || isSorted) {
+        return;
+    }
+    
+    nthElement(k);
     
-    // Implementação usando vector temporário para ordenação customizada
-    std::vector<T> temp;
-    temp.reserve(listSize);
+    Node* boundary = getNodeAt(k);
+    boundary->prev->next = nullptr;
+    Node* sortedHead = naturalMergeSort(headNode, order);
+    
+    Node* last = sortedHead;
+    while (last->next != nullptr) {
+        last = last->next;
+    }
+    last->next = boundary;
+    headNode = sortedHead;
+    relinkPrev();
+    isSorted = false;
+}
+
+// Partition estável religando nós
+template<class T, class Compare>
+template<typename Predicate>
+typename List<T, Compare>::Iterator List<T, Compare>::partition(Predicate pred) {
+    Node* matchHead = nullptr;
+    Node* matchTail = nullptr;
+    Node* restHead = nullptr;
+    Node* restTail = nullptr;
     
     Node* current = headNode;
     while (current != nullptr) {
-        temp.push_back(current->data);
-        current = current->next;
+        Node* next = current->next;
+        if (pred(current->data)) {
+            if (matchTail == nullptr) matchHead = current; else matchTail->next = current;
+            matchTail = current;
+        } else {
+            if (restTail == nullptr) restHead = current; else restTail->next = current;
+            restTail = current;
+        }
+        current = next;
     }
     
-    std::sort(temp.begin(), temp.end(), comparator);
+    if (matchTail == nullptr || restTail == nullptr) {
+        return Iterator(restHead); // Nada mudou de ordem
+    }
     
-    current = headNode;
-    for (const auto& item : temp) {
-        current->data = item;
+    matchTail->next = restHead;
+    restTail->next = nullptr;
+    headNode = matchHead;
+    relinkPrev();
+    isSorted = false;
+    return Iterator(restHead);
+}
+
+// Top k com heap limitado a k elementos: O(n log k)
+template<class T, class Compare>
+List<T, Compare> List<T, Compare>::topK(size_t k, std::function<bool(const T&, const T&)> comparator) const {
+    List<T, Compare> result;
+    if (k == 0) {
+        return result;
+    }
+    
+    // O topo do heap é o pior dos k melhores vistos até agora
+    std::priority_queue<T, std::vector<T>, std::function<bool(const T&, const T&)>> heap(comparator);
+    
+    Node* current = headNode;
+    while (current != nullptr) {
+        if (heap.size() < k) {
+            heap.push(current->data);
+        } else if (comparator(current->data, heap.top())) {
+            heap.pop();
+            heap.push(current->data);
+        }
         current = current->next;
     }
     
-    isSorted = false; // Não sabemos se está ordenada com comparador padrão
+    while (!heap.empty()) {
+        result.pushFront(heap.top());
+        heap.pop();
+    }
+    return result;
 }
 
-// Merge sort recursivo
-template<class T>
-typename List<T>::Node* List<T>::mergeSort(Node* head) {
+// Merge sort natural (estilo TimSort) sobre a cadeia next.
+// Runs não decrescentes são usados como estão; runs estritamente decrescentes
+// são invertidos durante a varredura (sem quebrar a estabilidade). Os runs vão
+// para uma pilha que mantém os invariantes do TimSort, limitando a profundidade
+// a O(log n) e o trabalho total a O(n log n); entradas quase ordenadas geram
+// poucos runs e custam perto de O(n).
+template<class T, class Compare>
+template<typename Less>
+typename List<T, Compare>::Node* List<T, Compare>::naturalMergeSort(Node* head, Less less) {
     if (head == nullptr || head->next == nullptr) {
         return head;
     }
     
-    // Encontra o meio da lista
-    Node* slow = head;
-    Node* fast = head;
-    Node* prev = nullptr;
+    SortRun stack[128];
+    size_t depth = 0;
     
-    while (fast != nullptr && fast->next != nullptr) {
-        prev = slow;
-        slow = slow->next;
-        fast = fast->next->next;
-    }
+    auto mergeAt = [&stack, &depth, &less](size_t i) {
+        stack[i] = mergeRuns(stack[i], stack[i + 1], less);
+        for (size_t j = i + 1; j + 1 < depth; ++j) {
+            stack[j] = stack[j + 1];
+        }
+        --depth;
+    };
     
-    // Quebra a lista no meio
-    prev->next = nullptr;
+    Node* current = head;
+    while (current != nullptr) {
+        SortRun run;
+        Node* next = current->next;
+        
+        if (next != nullptr && less(next->data, current->data)) {
+            // Run estritamente decrescente: inverte enquanto avança
+            run.tail = current;
+            run.head = current;
+            run.length = 1;
+            current->next = nullptr;
+            Node* previous = current;
+            current = next;
+            while (current != nullptr && less(current->data, previous->data)) {
+                next = current->next;
+                current->next = run.head;
+                run.head = current;
+                ++run.length;
+                previous = current;
+                current = next;
+            }
+        } else {
+            // Run não decrescente
+            run.head = current;
+            run.tail = current;
+            run.length = 1;
+            while (run.tail->next != nullptr && !less(run.tail->next->data, run.tail->data)) {
+                run.tail = run.tail->next;
+                ++run.length;
+            }
+            current = run.tail->next;
+            run.tail->next = nullptr;
+        }
+        
+        stack[depth++] = run;
+        
+        // Restaura os invariantes da pilha de runs
+        while (depth > 1) {
+            size_t n = depth - 2;
+            if ((n > 0 && stack[n - 1].length <= stack[n].length + stack[n + 1].length) ||
+                (n > 1 && stack[n - 2].length <= stack[n - 1].length + stack[n].length)) {
+                if (stack[n - 1].length < stack[n + 1].length) {
+                    --n;
+                }
+            } else if (stack[n].length > stack[n + 1].length) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
     
-    // Ordena recursivamente as duas metades
-    Node* left = mergeSort(head);
-    Node* right = mergeSort(slow);
+    while (depth > 1) {
+        size_t n = depth - 2;
+        if (n > 0 && stack[n - 1].length < stack[n + 1].length) {
+            --n;
+        }
+        mergeAt(n);
+    }
     
-    // Merge das duas metades ordenadas
-    return merge(left, right);
+    return stack[0].head;
 }
 
-template<class T>
-typename List<T>::Node* List<T>::merge(Node* left, Node* right) {
-    if (left == nullptr) return right;
-    if (right == nullptr) return left;
+// Merge de dois runs adjacentes (left vem antes: empates ficam com left).
+// Em vez de religar elemento a elemento, avança enquanto o mesmo lado vence
+// e emenda o bloco inteiro de uma vez; se os runs já estão em ordem, O(1).
+template<class T, class Compare>
+template<typename Less>
+typename List<T, Compare>::SortRun List<T, Compare>::mergeRuns(SortRun left, SortRun right, Less less) {
+    SortRun result{nullptr, nullptr, left.length + right.length};
+    
+    if (!less(right.head->data, left.tail->data)) {
+        left.tail->next = right.head;
+        result.head = left.head;
+        result.tail = right.tail;
+        return result;
+    }
     
-    Node* result = nullptr;
+    Node* tail = nullptr;
+    Node* x = left.head;
+    Node* y = right.head;
     
-    if (left->data <= right->data) {
-        result = left;
-        result->next = merge(left->next, right);
+    while (x != nullptr && y != nullptr) {
+        Node* blockStart;
+        Node* blockEnd;
+        if (less(y->data, x->data)) {
+            blockStart = blockEnd = y;
+            while (blockEnd->next != nullptr && less(blockEnd->next->data, x->data)) {
+                blockEnd = blockEnd->next;
+            }
+            y = blockEnd->next;
+        } else {
+            blockStart = blockEnd = x;
+            while (blockEnd->next != nullptr && !less(y->data, blockEnd->next->data)) {
+                blockEnd = blockEnd->next;
+            }
+            x = blockEnd->next;
+        }
+        
+        if (tail == nullptr) {
+            result.head = blockStart;
+        } else {
+            tail->next = blockStart;
+        }
+        tail = blockEnd;
+    }
+    
+    if (x != nullptr) {
+        tail->next = x;
+        result.tail = left.tail;
     } else {
-        result = right;
-        result->next = merge(left, right->next);
+        tail->next = y;
+        result.tail = right.tail;
     }
     
     return result;
 }
 
 // Is sorted check
-template<class T>
-bool List<T>::isSortedCheck() const {
+template<class T, class Compare>
+bool List<T, Compare>::isSortedCheck() const {
     if (listSize <= 1) {
         return true;
     }
     
     Node* current = headNode;
     while (current->next != nullptr) {
-        if (current->data > current->next->data) {
+        if (order(current->next->data, current->data)) {
             return false;
         }
         current = current->next;
@@ -1380,8 +2202,8 @@ bool List<T>::isSortedCheck() const {
     return true;
 }
 
-template<class T>
-bool List<T>::isSortedCheck(std::function<bool(const T&, const T&)> comparator) const {
+template<class T, class Compare>
+bool List<T, Compare>::isSortedCheck(std::function<bool(const T&, const T&)> comparator) const {
     if (listSize <= 1) {
         return true;
     }
@@ -1398,18 +2220,18 @@ bool List<T>::isSortedCheck(std::function<bool(const T&, const T&)> comparator)
 }
 
 // Merge with another list
-template<class T>
-void List<T>::merge(List& other) {
+template<class T, class Compare>
+void List<T, Compare>::merge(List& other) {
     if (!isSorted) sort();
     if (!other.isSorted) other.sort();
     
-    List<T> result;
+    List<T, Compare> result;
     
     Node* current1 = headNode;
     Node* current2 = other.headNode;
     
     while (current1 != nullptr && current2 != nullptr) {
-        if (current1->data <= current2->data) {
+        if (!order(current2->data, current1->data)) {
             result.pushBack(current1->data);
             current1 = current1->next;
         } else {
@@ -1432,9 +2254,9 @@ void List<T>::merge(List& other) {
     other.clear();
 }
 
-template<class T>
-void List<T>::merge(List& other, std::function<bool(const T&, const T&)> comparator) {
-    List<T> result;
+template<class T, class Compare>
+void List<T, Compare>::merge(List& other, std::function<bool(const T&, const T&)> comparator) {
+    List<T, Compare> result;
     
     Node* current1 = headNode;
     Node* current2 = other.headNode;
@@ -1463,18 +2285,144 @@ void List<T>::merge(List& other, std::function<bool(const T&, const T&)> compara
     other.clear();
 }
 
+// Set merge: percorre as duas listas uma vez, religando ou liberando cada nó
+template<class T, class Compare>
+void List<T, Compare>::setMerge(List& other, bool keepOnlyThis, bool keepOnlyOther, bool keepCommon) {
+    if (this == &other) {
+        if (!keepCommon) {
+            clear();
+        }
+        return;
+    }
+    
+    if (!isSorted) sort();
+    if (!other.isSorted) other.sort();
+    
+    Node* current1 = headNode;
+    Node* current2 = other.headNode;
+    
+    headNode = tailNode = nullptr;
+    listSize = 0;
+    other.headNode = other.tailNode = nullptr;
+    other.listSize = 0;
+    
+    auto keep = [this](Node* node) {
+        node->prev = tailNode;
+        if (tailNode == nullptr) {
+            headNode = node;
+        } else {
+            tailNode->next = node;
+        }
+        tailNode = node;
+        ++listSize;
+    };
+    
+    // Handles não migram entre listas: nós vindos de other perdem o seu
+    auto keepOther = [&keep, &other](Node* node) {
+        other.releaseHandle(node);
+        keep(node);
+    };
+    
+    while (current1 != nullptr && current2 != nullptr) {
+        Node* next1 = current1->next;
+        Node* next2 = current2->next;
+        
+        if (order(current1->data, current2->data)) {
+            if (keepOnlyThis) keep(current1); else destroyNode(current1);
+            current1 = next1;
+        } else if (order(current2->data, current1->data)) {
+            if (keepOnlyOther) keepOther(current2); else other.destroyNode(current2);
+            current2 = next2;
+        } else {
+            if (keepCommon) keep(current1); else destroyNode(current1);
+            other.destroyNode(current2);
+            current1 = next1;
+            current2 = next2;
+        }
+    }
+    
+    // Restos: religa se mantidos, senão libera
+    while (current1 != nullptr) {
+        Node* next1 = current1->next;
+        if (keepOnlyThis) keep(current1); else destroyNode(current1);
+        current1 = next1;
+    }
+    
+    while (current2 != nullptr) {
+        Node* next2 = current2->next;
+        if (keepOnlyOther) keepOther(current2); else other.destroyNode(current2);
+        current2 = next2;
+    }
+    
+    if (tailNode != nullptr) {
+        tailNode->next = nullptr;
+    }
+    isSorted = true;
+    other.isSorted = true;
+}
+
+template<class T, class Compare>
+void List<T, Compare>::setUnion(List& other) {
+    setMerge(other, true, true, true);
+}
+
+template<class T, class Compare>
+void List<T, Compare>::setIntersection(List& other) {
+    setMerge(other, false, false, true);
+}
+
+template<class T, class Compare>
+void List<T, Compare>::setDifference(List& other) {
+    setMerge(other, true, false, false);
+}
+
+template<class T, class Compare>
+void List<T, Compare>::setSymmetricDifference(List& other) {
+    setMerge(other, true, true, false);
+}
+
+// Includes
+template<class T, class Compare>
+bool List<T, Compare>::includes(const List& other) const {
+    // Listas não ordenadas são comparadas através de cópias ordenadas
+    if (!isSorted || !other.isSorted) {
+        List<T, Compare> sortedThis(*this);
+        List<T, Compare> sortedOther(other);
+        sortedThis.sort();
+        sortedOther.sort();
+        return sortedThis.includes(sortedOther);
+    }
+    
+    Node* current1 = headNode;
+    Node* current2 = other.headNode;
+    
+    while (current2 != nullptr) {
+        if (current1 == nullptr || order(current2->data, current1->data)) {
+            return false;
+        }
+        if (!order(current1->data, current2->data)) {
+            current2 = current2->next;
+        }
+        current1 = current1->next;
+    }
+    
+    return true;
+}
+
 // Clear
-template<class T>
-void List<T>::clear() {
+template<class T, class Compare>
+void List<T, Compare>::clear() {
     while (!empty()) {
         popFront();
     }
     isSorted = true;
+    handleSlots.clear();
+    freeHandleSlot = noHandle;
 }
 
 // Reverse
-template<class T>
-void List<T>::reverse() {
+template<class T, class Compare>
+void List<T, Compare>::reverse() {
     if (listSize <= 1) {
         return;
     }
@@ -1497,18 +2445,80 @@ void List<T>::reverse() {
     isSorted = false;
 }
 
+// Insere nó já alocado antes de node
+template<class T, class Compare>
+void List<T, Compare>::insertBefore(Node* node, Node* newNode) {
+    newNode->next = node;
+    if (node == nullptr) {
+        newNode->prev = tailNode;
+        if (tailNode == nullptr) headNode = newNode; else tailNode->next = newNode;
+        tailNode = newNode;
+    } else {
+        newNode->prev = node->prev;
+        if (node->prev == nullptr) headNode = newNode; else node->prev->next = newNode;
+        node->prev = newNode;
+    }
+    ++listSize;
+}
+
+// Remove nó da cadeia sem liberar memória
+template<class T, class Compare>
+void List<T, Compare>::removeNode(Node* node) {
+    if (node->prev == nullptr) headNode = node->next; else node->prev->next = node->next;
+    if (node->next == nullptr) tailNode = node->prev; else node->next->prev = node->prev;
+    node->next = node->prev = nullptr;
+    --listSize;
+}
+
+// Splice
+template<class T, class Compare>
+void List<T, Compare>::splice(Iterator pos, List& other, Iterator it) {
+    Node* node = it.current;
+    if (node == nullptr) {
+        throw std::out_of_range("Invalid iterator");
+    }
+    if (node == pos.current) {
+        return;
+    }
+    
+    other.removeNode(node);
+    if (&other != this) {
+        other.releaseHandle(node); // Handles não migram entre listas
+    }
+    insertBefore(pos.current, node);
+    
+    if (listSize > 1) isSorted = false;
+}
+
+template<class T, class Compare>
+void List<T, Compare>::moveToFront(Iterator it) {
+    if (it.current != headNode) {
+        splice(begin(), *this, it);
+    }
+}
+
+template<class T, class Compare>
+void List<T, Compare>::moveToBack(Iterator it) {
+    if (it.current != tailNode) {
+        splice(end(), *this, it);
+    }
+}
+
 // Swap
-template<class T>
-void List<T>::swap(List& other) noexcept {
+template<class T, class Compare>
+void List<T, Compare>::swap(List& other) noexcept {
     std::swap(headNode, other.headNode);
     std::swap(tailNode, other.tailNode);
     std::swap(listSize, other.listSize);
     std::swap(isSorted, other.isSorted);
+    std::swap(order, other.order);
+    std::swap(handleSlots, other.handleSlots);
+    std::swap(freeHandleSlot, other.freeHandleSlot);
 }
 
 // Resize
-template<class T>
-void List<T>::resize(size_t newSize, const T& value) {
+template<class T, class Compare>
+void List<T, Compare>::resize(size_t newSize, const T& value) {
     if (newSize < listSize) {
         while (listSize > newSize) {
             popBack();
@@ -1520,16 +2530,16 @@ void List<T>::resize(size_t newSize, const T& value) {
     }
 }
 
-// Unique
-template<class T>
-void List<T>::unique() {
+// Unique: a e b são duplicatas se nenhum precede o outro em order
+template<class T, class Compare>
+void List<T, Compare>::unique() {
     if (listSize <= 1) {
         return;
     }
     
     Node* current = headNode;
     while (current != nullptr && current->next != nullptr) {
-        if (current->data == current->next->data) {
+        if (!order(current->data, current->next->data) && !order(current->next->data, current->data)) {
             Node* duplicate = current->next;
             current->next = duplicate->next;
             if (duplicate->next != nullptr) {
@@ -1537,7 +2547,7 @@ void List<T>::unique() {
             } else {
                 tailNode = current;
             }
-            delete duplicate;
+            destroyNode(duplicate);
             --listSize;
         } else {
             current = current->next;
@@ -1545,8 +2555,8 @@ void List<T>::unique() {
     }
 }
 
-template<class T>
-void List<T>::unique(std::function<bool(const T&, const T&)> comparator) {
+template<class T, class Compare>
+void List<T, Compare>::unique(std::function<bool(const T&, const T&)> comparator) {
     if (listSize <= 1) {
         return;
     }
@@ -1561,7 +2571,7 @@ void List<T>::unique(std::function<bool(const T&, const T&)> comparator) {
             } else {
                 tailNode = current;
             }
-            delete duplicate;
+            destroyNode(duplicate);
             --listSize;
         } else {
             current = current->next;
@@ -1570,8 +2580,8 @@ void List<T>::unique(std::function<bool(const T&, const T&)> comparator) {
 }
 
 // Functional methods
-template<class T>
-void List<T>::forEach(std::function<void(T&)> func) {
+template<class T, class Compare>
+void List<T, Compare>::forEach(std::function<void(T&)> func) {
     Node* current = headNode;
     while (current != nullptr) {
         func(current->data);
@@ -1579,8 +2589,8 @@ void List<T>::forEach(std::function<void(T&)> func) {
     }
 }
 
-template<class T>
-void List<T>::forEach(std::function<void(const T&)> func) const {
+template<class T, class Compare>
+void List<T, Compare>::forEach(std::function<void(const T&)> func) const {
     Node* current = headNode;
     while (current != nullptr) {
         func(current->data);
@@ -1588,8 +2598,8 @@ void List<T>::forEach(std::function<void(const T&)> func) const {
     }
 }
 
-template<class T>
-bool List<T>::allOf(std::function<bool(const T&)> predicate) const {
+template<class T, class Compare>
+bool List<T, Compare>::allOf(std::function<bool(const T&)> predicate) const {
     Node* current = headNode;
     while (current != nullptr) {
         if (!predicate(current->data)) {
@@ -1600,8 +2610,8 @@ bool List<T>::allOf(std::function<bool(const T&)> predicate) const {
     return true;
 }
 
-template<class T>
-bool List<T>::anyOf(std::function<bool(const T&)> predicate) const {
+template<class T, class Compare>
+bool List<T, Compare>::anyOf(std::function<bool(const T&)> predicate) const {
     Node* current = headNode;
     while (current != nullptr) {
         if (predicate(current->data)) {
@@ -1612,14 +2622,14 @@ bool List<T>::anyOf(std::function<bool(const T&)> predicate) const {
     return false;
 }
 
-template<class T>
-bool List<T>::noneOf(std::function<bool(const T&)> predicate) const {
+template<class T, class Compare>
+bool List<T, Compare>::noneOf(std::function<bool(const T&)> predicate) const {
     return !anyOf(predicate);
 }
 
-template<class T>
+template<class T, class Compare>
 template<typename U>
-List<U> List<T>::map(std::function<U(const T&)> mapper) const {
+List<U> List<T, Compare>::map(std::function<U(const T&)> mapper) const {
     List<U> result;
     Node* current = headNode;
     while (current != nullptr) {
@@ -1629,9 +2639,9 @@ List<U> List<T>::map(std::function<U(const T&)> mapper) const {
     return result;
 }
 
-template<class T>
-List<T> List<T>::filter(std::function<bool(const T&)> predicate) const {
-    List<T> result;
+template<class T, class Compare>
+List<T, Compare> List<T, Compare>::filter(std::function<bool(const T&)> predicate) const {
+    List<T, Compare> result;
     Node* current = headNode;
     while (current != nullptr) {
         if (predicate(current->data)) {
@@ -1642,9 +2652,9 @@ List<T> List<T>::filter(std::function<bool(const T&)> predicate) const {
     return result;
 }
 
-template<class T>
+template<class T, class Compare>
 template<typename U>
-U List<T>::reduce(U initial, std::function<U(U, const T&)> reducer) const {
+U List<T, Compare>::reduce(U initial, std::function<U(U, const T&)> reducer) const {
     U result = initial;
     Node* current = headNode;
     while (current != nullptr) {
@@ -1655,8 +2665,8 @@ U List<T>::reduce(U initial, std::function<U(U, const T&)> reducer) const {
 }
 
 // Conversions
-template<class T>
-std::vector<T> List<T>::toVector() const {
+template<class T, class Compare>
+std::vector<T> List<T, Compare>::toVector() const {
     std::vector<T> result;
     result.reserve(listSize);
     Node* current = headNode;
@@ -1667,8 +2677,8 @@ std::vector<T> List<T>::toVector() const {
     return result;
 }
 
-template<class T>
-std::vector<T> List<T>::toVectorReverse() const {
+template<class T, class Compare>
+std::vector<T> List<T, Compare>::toVectorReverse() const {
     std::vector<T> result;
     result.reserve(listSize);
     Node* current = tailNode;
@@ -1680,8 +2690,8 @@ std::vector<T> List<T>::toVectorReverse() const {
 }
 
 // Comparison operators
-template<class T>
-bool List<T>::operator==(const List& other) const {
+template<class T, class Compare>
+bool List<T, Compare>::operator==(const List& other) const {
     if (listSize != other.listSize) {
         return false;
     }
@@ -1700,20 +2710,20 @@ bool List<T>::operator==(const List& other) const {
     return current1 == nullptr && current2 == nullptr;
 }
 
-template<class T>
-bool List<T>::operator!=(const List& other) const {
+template<class T, class Compare>
+bool List<T, Compare>::operator!=(const List& other) const {
     return !(*this == other);
 }
 
-template<class T>
-bool List<T>::operator<(const List& other) const {
+template<class T, class Compare>
+bool List<T, Compare>::operator<(const List& other) const {
     Node* current1 = headNode;
     Node* current2 = other.headNode;
     
     while (current1 != nullptr && current2 != nullptr) {
         if (current1->data < current2->data) {
             return true;
-        } else if (current1->data > current2->data) {
+        } else if (current2->data < current1->data) {
             return false;
         }
         current1 = current1->next;
@@ -1723,66 +2733,123 @@ bool List<T>::operator<(const List& other) const {
     return current1 == nullptr && current2 != nullptr;
 }
 
-template<class T>
-bool List<T>::operator<=(const List& other) const {
+template<class T, class Compare>
+bool List<T, Compare>::operator<=(const List& other) const {
     return *this < other || *this == other;
 }
 
-template<class T>
-bool List<T>::operator>(const List& other) const {
+template<class T, class Compare>
+bool List<T, Compare>::operator>(const List& other) const {
     return !(*this <= other);
 }
 
-template<class T>
-bool List<T>::operator>=(const List& other) const {
+template<class T, class Compare>
+bool List<T, Compare>::operator>=(const List& other) const {
     return !(*this < other);
 }
 
-// Print methods
-template<class T>
-void List<T>::print() const {
-    std::cout << "List [size=" << listSize << ", sorted=" << 
-                 (isSorted ? "true" : "false") << "]: ";
+// Print methods (bufferizados; terminam com '\n' sem forçar flush)
+template<class T, class Compare>
+void List<T, Compare>::print() const {
+    OutputBuffer out(std::cout);
+    out.append("List [size=");
+    out.appendValue(listSize);
+    out.append(isSorted ? ", sorted=true]: " : ", sorted=false]: ");
     if (empty()) {
-        std::cout << "(empty)";
+        out.append("(empty)");
     } else {
-        std::cout << "HEAD <-> ";
+        out.append("HEAD <-> ");
         Node* current = headNode;
         while (current != nullptr) {
-            std::cout << current->data;
+            out.appendValue(current->data);
             if (current->next != nullptr) {
-                std::cout << " <-> ";
+                out.append(" <-> ", 5);
             }
             current = current->next;
         }
-        std::cout << " <-> TAIL";
+        out.append(" <-> TAIL");
     }
-    std::cout << std::endl;
+    out.append('\n');
+    out.flush();
 }
 
-template<class T>
-void List<T>::printReverse() const {
-    std::cout << "List (reverse) [size=" << listSize << "]: ";
+template<class T, class Compare>
+void List<T, Compare>::printReverse() const {
+    OutputBuffer out(std::cout);
+    out.append("List (reverse) [size=");
+    out.appendValue(listSize);
+    out.append("]: ");
     if (empty()) {
-        std::cout << "(empty)";
+        out.append("(empty)");
     } else {
-        std::cout << "TAIL <-> ";
+        out.append("TAIL <-> ");
         Node* current = tailNode;
         while (current != nullptr) {
-            std::cout << current->data;
+            out.appendValue(current->data);
             if (current->prev != nullptr) {
-                std::cout << " <-> ";
+                out.append(" <-> ", 5);
             }
             current = current->prev;
         }
-        std::cout << " <-> HEAD";
+        out.append(" <-> HEAD");
+    }
+    out.append('\n');
+    out.flush();
+}
+
+// Escreve "[a, b, c]" ou, em modo preview, "[a, b, ... (n omitted), y, z]"
+template<class T, class Compare>
+void List<T, Compare>::writeElements(OutputBuffer& out, size_t previewCount) const {
+    bool truncated = previewCount > 0 && 2 * previewCount < listSize;
+    size_t leading = truncated ? previewCount : listSize;
+    
+    out.append('[');
+    Node* current = headNode;
+    for (size_t i = 0; i < leading; ++i) {
+        if (i > 0) {
+            out.append(", ", 2);
+        }
+        out.appendValue(current->data);
+        current = current->next;
+    }
+    
+    if (truncated) {
+        out.append(", ... (");
+        out.appendValue(listSize - 2 * previewCount);
+        out.append(" omitted)");
+        
+        current = tailNode;
+        for (size_t i = 1; i < previewCount; ++i) {
+            current = current->prev;
+        }
+        while (current != nullptr) {
+            out.append(", ", 2);
+            out.appendValue(current->data);
+            current = current->next;
+        }
     }
-    std::cout << std::endl;
+    out.append(']');
+}
+
+template<class T, class Compare>
+void List<T, Compare>::writeTo(std::ostream& os, size_t previewCount) const {
+    OutputBuffer out(os);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
+}
+
+template<class T, class Compare>
+void List<T, Compare>::writeTo(int fd, size_t previewCount) const {
+    OutputBuffer out(fd);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
 }
 
 // Check integrity
-template<class T>
-bool List<T>::checkIntegrity() const {
+template<class T, class Compare>
+bool List<T, Compare>::checkIntegrity() const {
     if (listSize == 0) {
         return headNode == nullptr && tailNode == nullptr;
     }
@@ -1835,8 +2902,8 @@ bool List<T>::checkIntegrity() const {
 }
 
 // Print stats
-template<class T>
-void List<T>::printStats() const {
+template<class T, class Compare>
+void List<T, Compare>::printStats() const {
     std::cout << "=== List Statistics ===" << std::endl;
     std::cout << "Size: " << listSize << std::endl;
     std::cout << "Empty: " << (empty() ? "Yes" : "No") << std::endl;
@@ -1850,20 +2917,11 @@ void List<T>::printStats() const {
 }
 
 // Output operator
-template<class T>
-std::ostream& operator<<(std::ostream& os, const List<T>& list) {
-    os << "[";
-    typename List<T>::Node* current = list.headNode;
-    bool first = true;
-    while (current != nullptr) {
-        if (!first) {
-            os << ", ";
-        }
-        os << current->data;
-        first = false;
-        current = current->next;
-    }
-    os << "]";
+template<class T, class Compare>
+std::ostream& operator<<(std::ostream& os, const List<T, Compare>& list) {
+    OutputBuffer out(os);
+    list.writeElements(out, 0);
+    out.flush();
     return os;
 }
 
@@ -0,0 +1,226 @@
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Contabilidade de memória dos containers.
+// memoryUsage() dos containers retorna um MemoryUsage; DeepSize<T> estende
+// a conta para a memória apontada pelos elementos; MemoryCounters agrega
+// alocações vivas (nós, blocos ou buffers) por tipo de container no processo
+// inteiro (ativado com CONTAINERS_MEMORY_COUNTERS, para não pagar atomics
+// por alocação por padrão).
+
+// ==================== RELATÓRIO ====================
+
+struct MemoryUsage {
+    size_t objectBytes;   // sizeof do próprio container
+    size_t nodeBytes;     // sizeof(Node) * nós (inclui payload, ponteiros e padding)
+    size_t payloadBytes;  // sizeof(T) * elementos (parte de nodeBytes)
+    size_t slackBytes;    // Estimativa de desperdício do alocador por nó
+    size_t overheadBytes; // Índices, tabelas e pools auxiliares
+    size_t deepBytes;     // Memória apontada pelos elementos (DeepSize<T>)
+
+    MemoryUsage()
+        : objectBytes(0), nodeBytes(0), payloadBytes(0), slackBytes(0), overheadBytes(0), deepBytes(0) {}
+
+    // Total ocupado (payloadBytes já está contido em nodeBytes)
+    size_t total() const {
+        return objectBytes + nodeBytes + slackBytes + overheadBytes + deepBytes;
+    }
+
+    // Fração do total que não é payload nem memória apontada
+    double overheadRatio() const {
+        size_t all = total();
+        return all == 0 ? 0.0 : 1.0 - static_cast<double>(payloadBytes + deepBytes) / static_cast<double>(all);
+    }
+
+    MemoryUsage& operator+=(const MemoryUsage& other) {
+        objectBytes += other.objectBytes;
+        nodeBytes += other.nodeBytes;
+        payloadBytes += other.payloadBytes;
+        slackBytes += other.slackBytes;
+        overheadBytes += other.overheadBytes;
+        deepBytes += other.deepBytes;
+        return *this;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage) {
+        return os << "{total: " << usage.total()
+                  << ", object: " << usage.objectBytes
+                  << ", nodes: " << usage.nodeBytes
+                  << ", payload: " << usage.payloadBytes
+                  << ", slack: " << usage.slackBytes
+                  << ", overhead: " << usage.overheadBytes
+                  << ", deep: " << usage.deepBytes << "}";
+    }
+};
+
+// Tamanho real de um bloco de heap para um pedido de 'requested' bytes.
+// Modelo do ptmalloc (glibc, 64 bits): cabeçalho de 8 bytes, alinhamento
+// de 16 e bloco mínimo de 32. É uma estimativa para outros alocadores.
+inline size_t allocationSize(size_t requested) {
+    size_t chunk = (requested + sizeof(size_t) + 15) & ~size_t(15);
+    return chunk < 32 ? 32 : chunk;
+}
+
+// Desperdício do alocador por bloco de 'requested' bytes
+inline size_t allocationSlack(size_t requested) {
+    return allocationSize(requested) - requested;
+}
+
+// ==================== TAMANHO PROFUNDO ====================
+
+// Gancho para memória de heap apontada por um elemento (fora do nó).
+// Especialize DeepSize<T> para tipos próprios; 'indirect' = false permite
+// que memoryUsage() não percorra os elementos.
+template<class T, class = void>
+struct DeepSize {
+    static constexpr bool indirect = false;
+    static size_t of(const T&) { return 0; }
+};
+
+// Containers deste repositório aninhados como elementos
+template<class T>
+struct DeepSize<T, std::void_t<decltype(std::declval<const T&>().memoryUsage())>> {
+    static constexpr bool indirect = true;
+    static size_t of(const T& value) { return value.memoryUsage().total() - sizeof(T); }
+};
+
+// std::string: só conta o buffer quando fora do SSO
+template<class Char, class Traits, class Alloc>
+struct DeepSize<std::basic_string<Char, Traits, Alloc>> {
+    static constexpr bool indirect = true;
+    static size_t of(const std::basic_string<Char, Traits, Alloc>& value) {
+        const char* data = reinterpret_cast<const char*>(value.data());
+        const char* object = reinterpret_cast<const char*>(&value);
+        if (data >= object && data < object + sizeof(value)) {
+            return 0;
+        }
+        return allocationSize((value.capacity() + 1) * sizeof(Char));
+    }
+};
+
+template<class U, class Alloc>
+struct DeepSize<std::vector<U, Alloc>> {
+    static constexpr bool indirect = true;
+    static size_t of(const std::vector<U, Alloc>& value) {
+        if (value.capacity() == 0) {
+            return 0;
+        }
+        size_t bytes = allocationSize(value.capacity() * sizeof(U));
+        if (DeepSize<U>::indirect) {
+            for (const U& item : value) {
+                bytes += DeepSize<U>::of(item);
+            }
+        }
+        return bytes;
+    }
+};
+
+template<class A, class B>
+struct DeepSize<std::pair<A, B>> {
+    static constexpr bool indirect = DeepSize<A>::indirect || DeepSize<B>::indirect;
+    static size_t of(const std::pair<A, B>& value) {
+        return DeepSize<A>::of(value.first) + DeepSize<B>::of(value.second);
+    }
+};
+
+// ==================== CONTADORES DO PROCESSO ====================
+
+enum class ContainerKind {
+    List,
+    Queue,
+    Stack,
+    Deque,
+    Count
+};
+
+// Leitura dos contadores de um tipo de container
+struct MemoryCounterSnapshot {
+    size_t liveNodes;   // Nós (ou blocos/buffers) alocados e ainda não liberados
+    size_t liveBytes;   // Bytes de heap dessas alocações (com slack estimado)
+    size_t allocations; // Total de alocações desde o início
+    size_t releases;    // Total de liberações desde o início
+};
+
+class MemoryCounters {
+private:
+    struct Counters {
+        std::atomic<size_t> liveNodes{0};
+        std::atomic<size_t> liveBytes{0};
+        std::atomic<size_t> allocations{0};
+        std::atomic<size_t> releases{0};
+    };
+
+    static Counters& counters(ContainerKind kind) {
+        static Counters table[static_cast<size_t>(ContainerKind::Count)];
+        return table[static_cast<size_t>(kind)];
+    }
+
+public:
+#ifdef CONTAINERS_MEMORY_COUNTERS
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    static void recordAllocation(ContainerKind kind, size_t bytes) {
+        Counters& entry = counters(kind);
+        entry.liveNodes.fetch_add(1, std::memory_order_relaxed);
+        entry.liveBytes.fetch_add(allocationSize(bytes), std::memory_order_relaxed);
+        entry.allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void recordRelease(ContainerKind kind, size_t bytes) {
+        Counters& entry = counters(kind);
+        entry.liveNodes.fetch_sub(1, std::memory_order_relaxed);
+        entry.liveBytes.fetch_sub(allocationSize(bytes), std::memory_order_relaxed);
+        entry.releases.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Zeros se os contadores não estiverem ativados
+    static MemoryCounterSnapshot snapshot(ContainerKind kind) {
+        const Counters& entry = counters(kind);
+        return {entry.liveNodes.load(std::memory_order_relaxed),
+                entry.liveBytes.load(std::memory_order_relaxed),
+                entry.allocations.load(std::memory_order_relaxed),
+                entry.releases.load(std::memory_order_relaxed)};
+    }
+
+    // Imprime uma linha por tipo de container
+    static void report(std::ostream& os) {
+        static const char* const names[] = {"List", "Queue", "Stack", "Deque"};
+        for (size_t i = 0; i < static_cast<size_t>(ContainerKind::Count); ++i) {
+            MemoryCounterSnapshot entry = snapshot(static_cast<ContainerKind>(i));
+            os << names[i] << ": " << entry.liveNodes << " nodes, " << entry.liveBytes
+               << " bytes live (" << entry.allocations << " allocated, "
+               << entry.releases << " released)\n";
+        }
+    }
+};
+
+// Base dos nós: com CONTAINERS_MEMORY_COUNTERS, new/delete dos nós passam
+// pelos contadores; sem ele, é uma base vazia (não altera sizeof(Node))
+template<ContainerKind Kind>
+struct CountedNode {
+#ifdef CONTAINERS_MEMORY_COUNTERS
+    static void* operator new(size_t bytes) {
+        void* memory = ::operator new(bytes);
+        MemoryCounters::recordAllocation(Kind, bytes);
+        return memory;
+    }
+
+    static void operator delete(void* memory, size_t bytes) {
+        MemoryCounters::recordRelease(Kind, bytes);
+        ::operator delete(memory);
+    }
+#endif
+};
+
+#endif // MEMORYUSAGE_H
@@ -0,0 +1,348 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// Fila limitada lock-free para múltiplos produtores e consumidores
+// (desenho de Vyukov: número de sequência por slot).
+// Cada slot guarda sequence: == posição  -> livre para o produtor dessa posição;
+//                            == posição+1 -> ocupado, pronto para o consumidor.
+// Produtores disputam enqueuePos e consumidores disputam dequeuePos com
+// um CAS cada; depois do CAS o slot é exclusivo e é publicado com uma
+// store release em sequence. Posições e slots ficam em linhas de cache
+// próprias para evitar falso compartilhamento.
+// Um slot reservado precisa sempre ser publicado ou liberado, senão a
+// fila para. Por isso só se constrói T dentro do slot sem exceção: cópias
+// que podem lançar são feitas antes da reserva, e o consumidor tira o
+// valor do slot (move sem exceção) e o libera antes de entregá-lo.
+template<class T>
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "MpmcQueue requires a nothrow move constructor");
+
+private:
+    static constexpr size_t cacheLine = 64;
+
+    struct alignas(cacheLine) Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() { return reinterpret_cast<T*>(storage); }
+    };
+
+    struct alignas(cacheLine) Position {
+        std::atomic<size_t> value;
+    };
+
+    Cell* cells;
+    size_t mask;
+    Position enqueuePos;
+    Position dequeuePos;
+
+    static size_t roundCapacity(size_t requested);
+
+    // Reserva até maxCount posições consecutivas cujo sequence seja
+    // posição + offset; retorna a primeira em first (0 se nenhuma)
+    size_t claim(Position& position, size_t offset, size_t maxCount, size_t& first);
+
+    // Destrói o valor do slot e o devolve aos produtores da próxima volta
+    void release(Cell& cell, size_t position);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor com capacidade (arredondada para potência de dois, mínimo 2)
+    explicit MpmcQueue(size_t capacity);
+
+    // Destrutor (sem produtores nem consumidores ativos)
+    ~MpmcQueue();
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // ==================== PRODUTORES ====================
+
+    // Tenta enfileirar; retorna false se estiver cheia
+    bool tryEnqueue(const T& value);
+    bool tryEnqueue(T&& value);
+
+    template<typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    // Enfileira esperando (spin + yield) enquanto estiver cheia
+    void enqueue(const T& value);
+    void enqueue(T&& value);
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // Enfileira até count elementos a partir de first com um único CAS;
+    // retorna quantos entraram (pode ser menos que count se encher).
+    // Se construir T a partir de *first pode lançar, enfileira um por vez:
+    // os elementos anteriores à exceção já estão na fila.
+    template<typename InputIt>
+    size_t tryEnqueueBulk(InputIt first, size_t count);
+
+    // ==================== CONSUMIDORES ====================
+
+    // Tenta remover o primeiro elemento para out; retorna false se vazia
+    bool tryDequeue(T& out);
+
+    // Remove e retorna o primeiro elemento, esperando enquanto estiver vazia
+    T dequeueAndReturn();
+
+    // Remove até maxCount elementos para out com um único CAS; retorna quantos.
+    // Se escrever em out lançar, o elemento sendo escrito e o resto do lote
+    // reservado são descartados e a fila continua utilizável.
+    template<typename OutputIt>
+    size_t tryDequeueBulk(OutputIt out, size_t maxCount);
+
+    // ==================== CONSULTA ====================
+
+    // Tamanho aproximado (exato se chamado sem concorrência)
+    size_t sizeApprox() const;
+    bool emptyApprox() const;
+    size_t capacity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+template<class T>
+size_t MpmcQueue<T>::roundCapacity(size_t requested) {
+    if (requested == 0) {
+        throw std::invalid_argument("MpmcQueue capacity must be positive");
+    }
+    size_t capacity = 2;
+    while (capacity < requested) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// Construtor: slot i começa livre para a posição i
+template<class T>
+MpmcQueue<T>::MpmcQueue(size_t capacity) {
+    size_t rounded = roundCapacity(capacity);
+    cells = new Cell[rounded];
+    mask = rounded - 1;
+    for (size_t i = 0; i < rounded; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueuePos.value.store(0, std::memory_order_relaxed);
+    dequeuePos.value.store(0, std::memory_order_relaxed);
+}
+
+// Destrutor
+template<class T>
+MpmcQueue<T>::~MpmcQueue() {
+    size_t position = dequeuePos.value.load(std::memory_order_relaxed);
+    size_t end = enqueuePos.value.load(std::memory_order_relaxed);
+    for (; position != end; ++position) {
+        cells[position & mask].value()->~T();
+    }
+    delete[] cells;
+}
+
+// Claim: offset 0 para produtores (slot livre), 1 para consumidores (slot cheio)
+template<class T>
+size_t MpmcQueue<T>::claim(Position& position, size_t offset, size_t maxCount, size_t& first) {
+    size_t current = position.value.load(std::memory_order_relaxed);
+
+    while (true) {
+        size_t available = 0;
+        while (available < maxCount && available <= mask) {
+            size_t sequence = cells[(current + available) & mask].sequence.load(std::memory_order_acquire);
+            if (sequence != current + available + offset) {
+                break;
+            }
+            ++available;
+        }
+
+        if (available == 0) {
+            size_t sequence = cells[current & mask].sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - (current + offset));
+            if (difference < 0) {
+                return 0; // Cheia (produtor) ou vazia (consumidor)
+            }
+            // Outro thread avançou a posição: recarrega
+            current = position.value.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (position.value.compare_exchange_weak(current, current + available, std::memory_order_relaxed)) {
+            first = current;
+            return available;
+        }
+        // current foi atualizado pelo CAS que falhou
+    }
+}
+
+template<class T>
+void MpmcQueue<T>::release(Cell& cell, size_t position) {
+    cell.value()->~T();
+    cell.sequence.store(position + mask + 1, std::memory_order_release);
+}
+
+// Produtores
+template<class T>
+template<typename... Args>
+bool MpmcQueue<T>::tryEmplace(Args&&... args) {
+    if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value) {
+        // Constrói fora do slot: se lançar, nenhum slot fica reservado sem valor
+        return tryEmplace(T(std::forward<Args>(args)...));
+    } else {
+        size_t position;
+        if (claim(enqueuePos, 0, 1, position) == 0) {
+            return false;
+        }
+
+        Cell& cell = cells[position & mask];
+        new (cell.value()) T(std::forward<Args>(args)...);
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+}
+
+template<class T>
+bool MpmcQueue<T>::tryEnqueue(const T& value) {
+    return tryEmplace(value);
+}
+
+template<class T>
+bool MpmcQueue<T>::tryEnqueue(T&& value) {
+    return tryEmplace(std::move(value));
+}
+
+template<class T>
+void MpmcQueue<T>::enqueue(const T& value) {
+    emplace(value);
+}
+
+template<class T>
+void MpmcQueue<T>::enqueue(T&& value) {
+    // tryEmplace só move depois de reservar o slot
+    while (!tryEmplace(std::move(value))) {
+        std::this_thread::yield();
+    }
+}
+
+template<class T>
+template<typename... Args>
+void MpmcQueue<T>::emplace(Args&&... args) {
+    if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value) {
+        // Constrói uma vez só, antes de esperar por espaço
+        enqueue(T(std::forward<Args>(args)...));
+    } else {
+        while (!tryEmplace(std::forward<Args>(args)...)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template<class T>
+template<typename InputIt>
+size_t MpmcQueue<T>::tryEnqueueBulk(InputIt first, size_t count) {
+    if constexpr (!std::is_nothrow_constructible<T, decltype(*first)>::value) {
+        // Uma cópia que lança no meio do lote deixaria slots reservados vazios
+        size_t pushed = 0;
+        while (pushed < count && tryEmplace(*first)) {
+            ++pushed;
+            ++first;
+        }
+        return pushed;
+    } else {
+        size_t position;
+        size_t claimed = claim(enqueuePos, 0, count, position);
+
+        for (size_t i = 0; i < claimed; ++i, ++first) {
+            Cell& cell = cells[(position + i) & mask];
+            new (cell.value()) T(*first);
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+}
+
+// Consumidores: liberam o slot para a próxima volta (posição + capacidade)
+// antes de qualquer operação do usuário que possa lançar
+template<class T>
+bool MpmcQueue<T>::tryDequeue(T& out) {
+    size_t position;
+    if (claim(dequeuePos, 1, 1, position) == 0) {
+        return false;
+    }
+
+    Cell& cell = cells[position & mask];
+    if constexpr (std::is_nothrow_move_assignable<T>::value) {
+        out = std::move(*cell.value());
+        release(cell, position);
+    } else {
+        T value(std::move(*cell.value()));
+        release(cell, position);
+        out = std::move(value);
+    }
+    return true;
+}
+
+template<class T>
+T MpmcQueue<T>::dequeueAndReturn() {
+    size_t position;
+    while (claim(dequeuePos, 1, 1, position) == 0) {
+        std::this_thread::yield();
+    }
+
+    Cell& cell = cells[position & mask];
+    T value(std::move(*cell.value()));
+    release(cell, position);
+    return value;
+}
+
+template<class T>
+template<typename OutputIt>
+size_t MpmcQueue<T>::tryDequeueBulk(OutputIt out, size_t maxCount) {
+    size_t position;
+    size_t claimed = claim(dequeuePos, 1, maxCount, position);
+
+    size_t i = 0;
+    try {
+        for (; i < claimed; ++i) {
+            Cell& cell = cells[(position + i) & mask];
+            T value(std::move(*cell.value()));
+            release(cell, position + i);
+            *out = std::move(value);
+            ++out;
+        }
+    } catch (...) {
+        // O slot i já foi liberado; o resto do lote é descartado
+        for (++i; i < claimed; ++i) {
+            release(cells[(position + i) & mask], position + i);
+        }
+        throw;
+    }
+    return claimed;
+}
+
+// Consulta
+template<class T>
+size_t MpmcQueue<T>::sizeApprox() const {
+    size_t head = dequeuePos.value.load(std::memory_order_relaxed);
+    size_t tail = enqueuePos.value.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+}
+
+template<class T>
+bool MpmcQueue<T>::emptyApprox() const {
+    return sizeApprox() == 0;
+}
+
+template<class T>
+size_t MpmcQueue<T>::capacity() const {
+    return mask + 1;
+}
+
+#endif // MPMCQUEUE_H
@@ -0,0 +1,337 @@
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "MemoryUsage.h"
+
+// Fila ilimitada para múltiplos produtores e um consumidor (caixa de
+// mensagens de atores). Lista simplesmente encadeada intrusiva com nó
+// sentinela (desenho de Vyukov):
+//   - enqueue é wait-free: um exchange em tail e uma store no next do
+//     nó anterior;
+//   - o consumidor lê head->next (acquire) sem CAS; o nó consumido vira
+//     a nova sentinela.
+// Entre o exchange e a store do next, o elemento já foi aceito mas ainda
+// não é visível: o consumidor o vê como vazio e o encontra na próxima
+// chamada.
+//
+// Reciclagem de nós em dois níveis:
+//   - cada fila tem a sua lista livre, em linha de cache própria. O
+//     consumidor guarda os nós liberados em uma reserva (sem atomics) e,
+//     quando ela junta um lote e a lista livre está vazia, publica o lote
+//     inteiro com um CAS;
+//   - cada thread produtora tem um cache local, compartilhado por todas
+//     as filas de mesmo T. Com o cache vazio, o produtor pega a lista livre
+//     da fila em que está enfileirando com um exchange. Os nós que sobram
+//     podem ir para outra fila de mesmo T e, consumidos lá, voltam para a
+//     lista livre daquela fila. O cache nunca passa de spareLimit nós.
+// A lista livre só recebe uma cadeia quando está vazia e só é esvaziada
+// inteira, então não há pop com CAS nem problema de ABA. Nós além do
+// limite da reserva voltam ao heap.
+//
+// Regras de uso: enqueue/emplace em qualquer thread; tryDequeue,
+// dequeueAndReturn, peek e drainAll apenas na thread consumidora.
+template<class T>
+class MpscQueue {
+private:
+    static constexpr size_t cacheLine = 64;
+    static constexpr size_t publishBatch = 32; // Nós na reserva antes de publicar
+    static constexpr size_t spareLimit = 1024; // Máximo na reserva e em cada cache local
+
+    struct Node : CountedNode<ContainerKind::Queue> {
+        std::atomic<Node*> next; // Próximo na fila, na reserva ou na lista livre
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() { return reinterpret_cast<T*>(storage); }
+    };
+
+    // Cache de nós da thread produtora; liberado quando a thread termina
+    struct LocalCache {
+        Node* first = nullptr;
+        ~LocalCache() { deleteChain(first); }
+    };
+
+    static LocalCache& localCache();
+    static void deleteChain(Node* node);
+
+    // Lado dos produtores
+    struct alignas(cacheLine) ProducerSide {
+        std::atomic<Node*> tail;
+    };
+
+    // Lado do consumidor: head é a sentinela (valor já consumido ou nenhum);
+    // spare é a reserva de nós liberados ainda não publicada
+    struct alignas(cacheLine) ConsumerSide {
+        Node* head;
+        Node* spare;
+        size_t spareCount;
+    };
+
+    // Lista livre desta fila (lote publicado pelo consumidor)
+    struct alignas(cacheLine) FreeSide {
+        std::atomic<Node*> top;
+    };
+
+    ProducerSide producer;
+    ConsumerSide consumer;
+    FreeSide freeNodes;
+
+    // Produtor: cache local, depois a lista livre desta fila, depois o heap
+    Node* acquireNode();
+
+    // Devolve ao cache local um nó que não chegou a ser publicado
+    static void giveBack(Node* node);
+
+    // Consumidor: guarda um nó liberado na reserva e publica o lote se der
+    void recycle(Node* node);
+
+    template<typename... Args>
+    void publish(Args&&... args);
+
+    // Consome o primeiro elemento (next de head): destrói o valor, avança
+    // head e recicla a sentinela antiga
+    void advance(Node* next);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor padrão
+    MpscQueue();
+
+    // Destrutor (sem produtores nem consumidor ativos)
+    ~MpscQueue();
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // ==================== PRODUTORES ====================
+
+    // Enfileira (wait-free se o pool tiver nós livres)
+    void enqueue(const T& value);
+    void enqueue(T&& value);
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // ==================== CONSUMIDOR ====================
+
+    // Tenta remover o primeiro elemento para out; retorna false se vazia
+    bool tryDequeue(T& out);
+
+    // Remove e retorna o primeiro elemento
+    T dequeueAndReturn();
+
+    // Ponteiro para o primeiro elemento ou nullptr se vazia
+    T* peek();
+
+    // Consome tudo que estava enfileirado no momento da chamada, na ordem,
+    // chamando callback(T&&) para cada elemento. Retorna quantos elementos
+    // foram consumidos.
+    template<typename Callback>
+    size_t drainAll(Callback callback);
+
+    // ==================== CONSULTA ====================
+
+    // Vazia do ponto de vista do consumidor
+    bool empty() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Pool de nós
+template<class T>
+typename MpscQueue<T>::LocalCache& MpscQueue<T>::localCache() {
+    static thread_local LocalCache instance;
+    return instance;
+}
+
+template<class T>
+void MpscQueue<T>::deleteChain(Node* node) {
+    while (node != nullptr) {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
+}
+
+// A lista livre tem no máximo spareLimit nós, então o cache local também
+template<class T>
+typename MpscQueue<T>::Node* MpscQueue<T>::acquireNode() {
+    LocalCache& cache = localCache();
+    if (cache.first == nullptr) {
+        if (freeNodes.top.load(std::memory_order_relaxed) == nullptr) {
+            return new Node;
+        }
+        cache.first = freeNodes.top.exchange(nullptr, std::memory_order_acquire);
+        if (cache.first == nullptr) {
+            return new Node;
+        }
+    }
+    Node* node = cache.first;
+    cache.first = node->next.load(std::memory_order_relaxed);
+    return node;
+}
+
+template<class T>
+void MpscQueue<T>::giveBack(Node* node) {
+    LocalCache& cache = localCache();
+    node->next.store(cache.first, std::memory_order_relaxed);
+    cache.first = node;
+}
+
+// Publica a reserva só na lista livre vazia: a cadeia nunca é ligada a
+// outra e a store release do CAS torna os next visíveis ao produtor
+template<class T>
+void MpscQueue<T>::recycle(Node* node) {
+    if (consumer.spareCount >= publishBatch && freeNodes.top.load(std::memory_order_relaxed) == nullptr) {
+        Node* expected = nullptr;
+        if (freeNodes.top.compare_exchange_strong(expected, consumer.spare, std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            consumer.spare = nullptr;
+            consumer.spareCount = 0;
+        }
+    }
+
+    if (consumer.spareCount >= spareLimit) {
+        delete node;
+        return;
+    }
+    node->next.store(consumer.spare, std::memory_order_relaxed);
+    consumer.spare = node;
+    ++consumer.spareCount;
+}
+
+// Construtor: head e tail começam na mesma sentinela
+template<class T>
+MpscQueue<T>::MpscQueue() {
+    freeNodes.top.store(nullptr, std::memory_order_relaxed);
+    consumer.spare = nullptr;
+    consumer.spareCount = 0;
+
+    Node* stub = acquireNode();
+    stub->next.store(nullptr, std::memory_order_relaxed);
+    consumer.head = stub;
+    producer.tail.store(stub, std::memory_order_relaxed);
+}
+
+// Destrutor: destrói os valores pendentes e libera todos os nós da fila
+template<class T>
+MpscQueue<T>::~MpscQueue() {
+    Node* node = consumer.head->next.load(std::memory_order_acquire);
+    while (node != nullptr) {
+        node->value()->~T();
+        node = node->next.load(std::memory_order_acquire);
+    }
+    deleteChain(consumer.head);
+    deleteChain(consumer.spare);
+    deleteChain(freeNodes.top.load(std::memory_order_acquire));
+}
+
+// Produtores: o valor é construído antes de o nó ficar visível
+template<class T>
+template<typename... Args>
+void MpscQueue<T>::publish(Args&&... args) {
+    Node* node = acquireNode();
+    try {
+        new (node->value()) T(std::forward<Args>(args)...);
+    } catch (...) {
+        giveBack(node);
+        throw;
+    }
+    node->next.store(nullptr, std::memory_order_relaxed);
+
+    Node* previous = producer.tail.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+
+template<class T>
+void MpscQueue<T>::enqueue(const T& value) {
+    publish(value);
+}
+
+template<class T>
+void MpscQueue<T>::enqueue(T&& value) {
+    publish(std::move(value));
+}
+
+template<class T>
+template<typename... Args>
+void MpscQueue<T>::emplace(Args&&... args) {
+    publish(std::forward<Args>(args)...);
+}
+
+// Consumidor
+template<class T>
+void MpscQueue<T>::advance(Node* next) {
+    next->value()->~T();
+    Node* old = consumer.head;
+    consumer.head = next;
+    recycle(old);
+}
+
+template<class T>
+T* MpscQueue<T>::peek() {
+    Node* next = consumer.head->next.load(std::memory_order_acquire);
+    return next == nullptr ? nullptr : next->value();
+}
+
+template<class T>
+bool MpscQueue<T>::tryDequeue(T& out) {
+    Node* next = consumer.head->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+        return false;
+    }
+
+    out = std::move(*next->value());
+    advance(next);
+    return true;
+}
+
+template<class T>
+T MpscQueue<T>::dequeueAndReturn() {
+    Node* next = consumer.head->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+        throw std::underflow_error("Queue is empty");
+    }
+
+    T value = std::move(*next->value());
+    advance(next);
+    return value;
+}
+
+// drainAll: tail lido uma vez limita a drenagem (produtores rápidos não a
+// prolongam); para antes se um produtor ainda não ligou seu nó
+template<class T>
+template<typename Callback>
+size_t MpscQueue<T>::drainAll(Callback callback) {
+    Node* last = producer.tail.load(std::memory_order_acquire);
+    size_t drained = 0;
+
+    while (consumer.head != last) {
+        Node* next = consumer.head->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            break;
+        }
+        // O elemento conta como consumido mesmo se o callback lançar
+        try {
+            callback(std::move(*next->value()));
+        } catch (...) {
+            advance(next);
+            throw;
+        }
+        advance(next);
+        ++drained;
+    }
+    return drained;
+}
+
+// Consulta
+template<class T>
+bool MpscQueue<T>::empty() const {
+    return consumer.head->next.load(std::memory_order_acquire) == nullptr;
+}
+
+#endif // MPSCQUEUE_H
@@ -0,0 +1,157 @@
+#ifndef OUTPUTBUFFER_H
+#define OUTPUTBUFFER_H
+
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unistd.h>
+
+// Buffer de saída de texto usado por operator<<, print() e writeTo().
+// Os elementos são formatados em um buffer reutilizável (std::to_chars para
+// tipos aritméticos) e escritos em blocos de até chunk bytes no ostream ou
+// descritor. O buffer cresce sob demanda, então imprimir um container
+// pequeno não paga a alocação de um bloco inteiro.
+// Com um ostream, a formatação padrão do stream é respeitada: se houver
+// flags não padrão (hex, boolalpha, ...), cai no caminho de operator<<.
+class OutputBuffer {
+private:
+    static constexpr size_t defaultChunkSize = size_t(64) << 10;
+
+    std::string buffer;
+    size_t chunkSize;
+    std::ostream* stream;
+    int fd;
+    int precision;
+    bool fastFormat;             // false: formata via ostringstream com as flags do stream
+    std::unique_ptr<std::ostringstream> fallback; // Criado no primeiro valor não aritmético
+
+    void writeChunk(const char* data, size_t bytes);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    explicit OutputBuffer(std::ostream& os, size_t chunk = defaultChunkSize);
+    explicit OutputBuffer(int fileDescriptor, size_t chunk = defaultChunkSize);
+
+    // Destrutor: descarga de último recurso, que engole erros de escrita.
+    // Quem escreve deve chamar flush() no fim para que os erros propaguem.
+    ~OutputBuffer();
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    // ==================== ESCRITA ====================
+
+    void append(char c);
+    void append(const char* text);
+    void append(const char* text, size_t length);
+
+    // Formata um valor como operator<< faria
+    template<typename T>
+    void appendValue(const T& value);
+
+    // Escreve o conteúdo do buffer no destino
+    void flush();
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+inline OutputBuffer::OutputBuffer(std::ostream& os, size_t chunk)
+    : chunkSize(chunk), stream(&os), fd(-1), precision(static_cast<int>(os.precision())),
+      fastFormat((os.flags() & ~std::ios_base::skipws) == std::ios_base::dec) {}
+
+inline OutputBuffer::OutputBuffer(int fileDescriptor, size_t chunk)
+    : chunkSize(chunk), stream(nullptr), fd(fileDescriptor), precision(6), fastFormat(true) {}
+
+inline OutputBuffer::~OutputBuffer() {
+    try {
+        flush();
+    } catch (...) {
+        // Só chega aqui se o chamador não chamou flush() (ex.: exceção no meio)
+    }
+}
+
+inline void OutputBuffer::writeChunk(const char* data, size_t bytes) {
+    if (stream != nullptr) {
+        stream->write(data, static_cast<std::streamsize>(bytes));
+        return;
+    }
+
+    while (bytes > 0) {
+        ssize_t result = ::write(fd, data, bytes);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Output write failed: ") + std::strerror(errno));
+        }
+        data += result;
+        bytes -= static_cast<size_t>(result);
+    }
+}
+
+inline void OutputBuffer::flush() {
+    if (!buffer.empty()) {
+        writeChunk(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+}
+
+inline void OutputBuffer::append(char c) {
+    buffer.push_back(c);
+    if (buffer.size() >= chunkSize) {
+        flush();
+    }
+}
+
+inline void OutputBuffer::append(const char* text) {
+    append(text, std::strlen(text));
+}
+
+inline void OutputBuffer::append(const char* text, size_t length) {
+    buffer.append(text, length);
+    if (buffer.size() >= chunkSize) {
+        flush();
+    }
+}
+
+// Append value: to_chars para aritméticos, operator<< para o resto
+template<typename T>
+void OutputBuffer::appendValue(const T& value) {
+    if constexpr (std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                  std::is_same<T, unsigned char>::value) {
+        append(static_cast<char>(value));
+        return;
+    } else if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) {
+        if (fastFormat) {
+            char digits[64];
+            std::to_chars_result result;
+            if constexpr (std::is_floating_point<T>::value) {
+                result = std::to_chars(digits, digits + sizeof(digits), value,
+                                       std::chars_format::general, precision);
+            } else {
+                result = std::to_chars(digits, digits + sizeof(digits), value);
+            }
+            append(digits, static_cast<size_t>(result.ptr - digits));
+            return;
+        }
+    }
+
+    // Caminho genérico: um ostringstream com as flags do destino, reaproveitado
+    if (!fallback) {
+        fallback = std::make_unique<std::ostringstream>();
+        if (stream != nullptr) {
+            fallback->copyfmt(*stream);
+        }
+    } else {
+        fallback->str(std::string());
+    }
+    *fallback << value;
+    const std::string& text = fallback->str();
+    append(text.data(), text.size());
+}
+
+#endif // OUTPUTBUFFER_H
@@ -0,0 +1,581 @@
+#ifndef PAIRINGHEAP_H
+#define PAIRINGHEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "MemoryUsage.h"
+
+// Pairing heap: alternativa a PriorityQueue com a mesma interface e a
+// mesma convenção de Compare (order(a, b) == true se a tem prioridade
+// menor). Cada elemento é um nó próprio, então enqueue, merge e
+// decreaseKey são O(1) (amortizado) e handles são ponteiros estáveis;
+// dequeue e erase custam O(log n) amortizado. Vale a pena quando há
+// muito mais decreaseKey/merge do que dequeue (Dijkstra em grafos densos);
+// caso contrário o heap d-ário de PriorityQueue é mais rápido.
+//
+// Representação filho-esquerdo/irmão-direito: prev aponta para o pai no
+// primeiro filho e para o irmão anterior nos demais.
+//
+// Handles valem enquanto o elemento estiver no heap; usar o handle de um
+// elemento já removido é indefinido (não há tabela para verificar).
+template<class T, class Compare = std::less<T>>
+class PairingHeap {
+private:
+    struct Node {
+        T value;
+        Node* child;
+        Node* next;
+        Node* prev;
+
+        template<typename... Args>
+        explicit Node(Args&&... args)
+            : value(std::forward<Args>(args)...), child(nullptr), next(nullptr), prev(nullptr) {}
+    };
+
+public:
+    // Identifica um elemento do heap (copiável, sem posse)
+    class Handle {
+        friend class PairingHeap;
+
+    private:
+        Node* node;
+
+        explicit Handle(Node* target) : node(target) {}
+
+    public:
+        // Handle inválido
+        Handle() : node(nullptr) {}
+
+        bool operator==(const Handle& other) const { return node == other.node; }
+        bool operator!=(const Handle& other) const { return node != other.node; }
+    };
+
+private:
+    Node* root;
+    size_t heapSize;
+    Compare order;
+
+    // Métodos auxiliares privados
+    Node* meld(Node* first, Node* second) const;       // Une duas raízes
+    Node* mergePairs(Node* first) const;               // Duas passadas sobre uma lista de irmãos
+    static void cut(Node* node);                       // Separa node (não raiz) do pai/irmãos
+    void detach(Node* node);                           // Tira node do heap, devolvendo seus filhos
+    static Node* checkHandle(const Handle& handle);
+    void destroyAll();
+
+    // Visita todos os nós (pré-ordem, iterativo)
+    template<typename Visit>
+    static void visitNodes(Node* start, Visit visit);
+
+    template<typename... Args>
+    Handle insert(Args&&... args);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor padrão
+    PairingHeap();
+
+    // Construtor com comparador
+    explicit PairingHeap(const Compare& compare);
+
+    // Construtor de cópia (handles não são transferidos)
+    PairingHeap(const PairingHeap& other);
+
+    // Construtor de movimento (handles continuam válidos no destino)
+    PairingHeap(PairingHeap&& other) noexcept;
+
+    // Construtor com lista de inicialização
+    PairingHeap(std::initializer_list<T> init, const Compare& compare = Compare());
+
+    // Construtor a partir de intervalo de iteradores
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    PairingHeap(InputIt first, InputIt last, const Compare& compare = Compare());
+
+    // Destrutor
+    ~PairingHeap();
+
+    // ==================== OPERADORES DE ATRIBUIÇÃO ====================
+
+    PairingHeap& operator=(const PairingHeap& other);
+    PairingHeap& operator=(PairingHeap&& other) noexcept;
+
+    // ==================== MÉTODOS PRINCIPAIS ====================
+
+    // Adiciona elemento; retorna o handle para decreaseKey/update/erase
+    Handle enqueue(const T& value);
+    Handle enqueue(T&& value);
+
+    template<typename... Args>
+    Handle emplace(Args&&... args);
+
+    // Remove o elemento de maior prioridade
+    void dequeue();
+
+    // Remove e retorna o elemento de maior prioridade (movendo)
+    T dequeueAndReturn();
+
+    // Tenta remover o elemento de maior prioridade para out; false se vazio
+    bool tryDequeue(T& out);
+
+    // Elemento de maior prioridade (só leitura)
+    const T& front() const;
+
+    // Move todos os elementos de other para este heap em O(1); os handles
+    // de other passam a valer aqui (os comparadores devem ser equivalentes)
+    void merge(PairingHeap& other);
+
+    // ==================== HANDLES ====================
+
+    // Valor atual do elemento do handle
+    const T& get(const Handle& handle) const;
+
+    // Aumenta a prioridade do elemento em O(1) amortizado; lança
+    // invalid_argument se value tiver prioridade menor
+    void decreaseKey(const Handle& handle, const T& value);
+    void decreaseKey(const Handle& handle, T&& value);
+
+    // Troca o valor do elemento em qualquer direção
+    void update(const Handle& handle, const T& value);
+    void update(const Handle& handle, T&& value);
+
+    // Remove o elemento do handle e retorna seu valor
+    T erase(const Handle& handle);
+
+    // ==================== MÉTODOS DE CONSULTA ====================
+
+    bool empty() const;
+    size_t size() const;
+
+    // Memória ocupada: nós, slack do alocador e DeepSize<T>
+    MemoryUsage memoryUsage() const;
+
+    // ==================== OPERAÇÕES DE MANIPULAÇÃO ====================
+
+    // Limpa o heap (invalida todos os handles)
+    void clear();
+
+    // Troca conteúdo com outro heap
+    void swap(PairingHeap& other) noexcept;
+
+    // ==================== CONVERSÕES ====================
+
+    // Elementos em ordem de prioridade (maior primeiro), sem alterar o heap
+    std::vector<T> toSortedVector() const;
+
+    // ==================== MÉTODOS DE DEBUG ====================
+
+    // Verifica a ordem de heap, os ponteiros prev e o tamanho
+    bool checkIntegrity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Meld: a raiz de menor prioridade vira o primeiro filho da outra
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::meld(Node* first, Node* second) const {
+    if (first == nullptr) {
+        return second;
+    }
+    if (second == nullptr) {
+        return first;
+    }
+    if (order(first->value, second->value)) {
+        std::swap(first, second);
+    }
+
+    second->next = first->child;
+    if (first->child != nullptr) {
+        first->child->prev = second;
+    }
+    second->prev = first;
+    first->child = second;
+    return first;
+}
+
+// Merge pairs: une irmãos aos pares da esquerda para a direita e depois
+// acumula os pares da direita para a esquerda (garante o custo amortizado)
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::mergePairs(Node* first) const {
+    Node* pairs = nullptr;  // Pares já unidos, em ordem inversa (ligados por next)
+
+    while (first != nullptr) {
+        Node* a = first;
+        Node* b = a->next;
+        a->prev = nullptr;
+        if (b == nullptr) {
+            a->next = pairs;
+            pairs = a;
+            break;
+        }
+        first = b->next;
+        a->next = nullptr;
+        b->next = nullptr;
+        b->prev = nullptr;
+
+        Node* joined = meld(a, b);
+        joined->next = pairs;
+        pairs = joined;
+    }
+
+    Node* result = nullptr;
+    while (pairs != nullptr) {
+        Node* following = pairs->next;
+        pairs->next = nullptr;
+        result = meld(result, pairs);
+        pairs = following;
+    }
+    return result;
+}
+
+// Cut: prev é o pai se node for o primeiro filho
+template<class T, class Compare>
+void PairingHeap<T, Compare>::cut(Node* node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if (node->next != nullptr) {
+        node->next->prev = node->prev;
+    }
+    node->next = nullptr;
+    node->prev = nullptr;
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::detach(Node* node) {
+    Node* children = mergePairs(node->child);
+    node->child = nullptr;
+    if (node == root) {
+        root = children;
+    } else {
+        cut(node);
+        root = meld(root, children);
+    }
+}
+
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::checkHandle(const Handle& handle) {
+    if (handle.node == nullptr) {
+        throw std::invalid_argument("Invalid pairing heap handle");
+    }
+    return handle.node;
+}
+
+// Visit nodes: pilha explícita (a profundidade pode chegar a n)
+template<class T, class Compare>
+template<typename Visit>
+void PairingHeap<T, Compare>::visitNodes(Node* start, Visit visit) {
+    std::vector<Node*> pending;
+    if (start != nullptr) {
+        pending.push_back(start);
+    }
+    while (!pending.empty()) {
+        Node* node = pending.back();
+        pending.pop_back();
+        for (Node* child = node->child; child != nullptr; child = child->next) {
+            pending.push_back(child);
+        }
+        visit(node);
+    }
+}
+
+// Destroy all: os filhos de cada nó entram na lista antes de liberá-lo
+template<class T, class Compare>
+void PairingHeap<T, Compare>::destroyAll() {
+    Node* pending = root;
+    while (pending != nullptr) {
+        Node* node = pending;
+        pending = node->next;
+        if (node->child != nullptr) {
+            Node* last = node->child;
+            while (last->next != nullptr) {
+                last = last->next;
+            }
+            last->next = pending;
+            pending = node->child;
+        }
+        delete node;
+    }
+    root = nullptr;
+    heapSize = 0;
+}
+
+// Construtores
+template<class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap() : root(nullptr), heapSize(0), order() {}
+
+template<class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(const Compare& compare) : root(nullptr), heapSize(0), order(compare) {}
+
+template<class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(const PairingHeap& other) : root(nullptr), heapSize(0), order(other.order) {
+    try {
+        visitNodes(other.root, [this](Node* node) { insert(node->value); });
+    } catch (...) {
+        destroyAll();
+        throw;
+    }
+}
+
+template<class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(PairingHeap&& other) noexcept
+    : root(other.root), heapSize(other.heapSize), order(std::move(other.order)) {
+    other.root = nullptr;
+    other.heapSize = 0;
+}
+
+template<class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(std::initializer_list<T> init, const Compare& compare)
+    : PairingHeap(init.begin(), init.end(), compare) {}
+
+template<class T, class Compare>
+template<typename InputIt, typename>
+PairingHeap<T, Compare>::PairingHeap(InputIt first, InputIt last, const Compare& compare)
+    : root(nullptr), heapSize(0), order(compare) {
+    try {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    } catch (...) {
+        destroyAll();
+        throw;
+    }
+}
+
+// Destrutor
+template<class T, class Compare>
+PairingHeap<T, Compare>::~PairingHeap() {
+    destroyAll();
+}
+
+// Atribuição
+template<class T, class Compare>
+PairingHeap<T, Compare>& PairingHeap<T, Compare>::operator=(const PairingHeap& other) {
+    if (this != &other) {
+        PairingHeap temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template<class T, class Compare>
+PairingHeap<T, Compare>& PairingHeap<T, Compare>::operator=(PairingHeap&& other) noexcept {
+    if (this != &other) {
+        destroyAll();
+        root = other.root;
+        heapSize = other.heapSize;
+        order = std::move(other.order);
+        other.root = nullptr;
+        other.heapSize = 0;
+    }
+    return *this;
+}
+
+// Inserção
+template<class T, class Compare>
+template<typename... Args>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::insert(Args&&... args) {
+    Node* node = new Node(std::forward<Args>(args)...);
+    root = meld(root, node);
+    ++heapSize;
+    return Handle(node);
+}
+
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::enqueue(const T& value) {
+    return insert(value);
+}
+
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::enqueue(T&& value) {
+    return insert(std::move(value));
+}
+
+template<class T, class Compare>
+template<typename... Args>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::emplace(Args&&... args) {
+    return insert(std::forward<Args>(args)...);
+}
+
+// Remoção
+template<class T, class Compare>
+void PairingHeap<T, Compare>::dequeue() {
+    if (empty()) {
+        throw std::underflow_error("Pairing heap is empty");
+    }
+    Node* old = root;
+    root = mergePairs(old->child);
+    delete old;
+    --heapSize;
+}
+
+template<class T, class Compare>
+T PairingHeap<T, Compare>::dequeueAndReturn() {
+    if (empty()) {
+        throw std::underflow_error("Pairing heap is empty");
+    }
+    T value = std::move(root->value);
+    dequeue();
+    return value;
+}
+
+template<class T, class Compare>
+bool PairingHeap<T, Compare>::tryDequeue(T& out) {
+    if (empty()) {
+        return false;
+    }
+    out = std::move(root->value);
+    dequeue();
+    return true;
+}
+
+template<class T, class Compare>
+const T& PairingHeap<T, Compare>::front() const {
+    if (empty()) {
+        throw std::underflow_error("Pairing heap is empty");
+    }
+    return root->value;
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::merge(PairingHeap& other) {
+    if (this == &other) {
+        return;
+    }
+    root = meld(root, other.root);
+    heapSize += other.heapSize;
+    other.root = nullptr;
+    other.heapSize = 0;
+}
+
+// Handles
+template<class T, class Compare>
+const T& PairingHeap<T, Compare>::get(const Handle& handle) const {
+    return checkHandle(handle)->value;
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::decreaseKey(const Handle& handle, const T& value) {
+    decreaseKey(handle, T(value));
+}
+
+// Decrease key: só a subárvore do nó sobe, sem reorganizar os filhos
+template<class T, class Compare>
+void PairingHeap<T, Compare>::decreaseKey(const Handle& handle, T&& value) {
+    Node* node = checkHandle(handle);
+    if (order(value, node->value)) {
+        throw std::invalid_argument("decreaseKey would lower the priority");
+    }
+    node->value = std::move(value);
+    if (node != root) {
+        cut(node);
+        root = meld(root, node);
+    }
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::update(const Handle& handle, const T& value) {
+    update(handle, T(value));
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::update(const Handle& handle, T&& value) {
+    Node* node = checkHandle(handle);
+    if (!order(value, node->value)) {
+        decreaseKey(handle, std::move(value));
+        return;
+    }
+    // Prioridade menor: os filhos podem ter de subir acima do nó
+    detach(node);
+    node->value = std::move(value);
+    root = meld(root, node);
+}
+
+template<class T, class Compare>
+T PairingHeap<T, Compare>::erase(const Handle& handle) {
+    Node* node = checkHandle(handle);
+    detach(node);
+    T value = std::move(node->value);
+    delete node;
+    --heapSize;
+    return value;
+}
+
+// Consulta
+template<class T, class Compare>
+bool PairingHeap<T, Compare>::empty() const {
+    return heapSize == 0;
+}
+
+template<class T, class Compare>
+size_t PairingHeap<T, Compare>::size() const {
+    return heapSize;
+}
+
+template<class T, class Compare>
+MemoryUsage PairingHeap<T, Compare>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    usage.nodeBytes = heapSize * sizeof(Node);
+    usage.payloadBytes = heapSize * sizeof(T);
+    usage.slackBytes = heapSize * allocationSlack(sizeof(Node));
+    if (DeepSize<T>::indirect) {
+        visitNodes(root, [&usage](Node* node) { usage.deepBytes += DeepSize<T>::of(node->value); });
+    }
+    return usage;
+}
+
+// Manipulação
+template<class T, class Compare>
+void PairingHeap<T, Compare>::clear() {
+    destroyAll();
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::swap(PairingHeap& other) noexcept {
+    using std::swap;
+    swap(root, other.root);
+    swap(heapSize, other.heapSize);
+    swap(order, other.order);
+}
+
+// Conversões
+template<class T, class Compare>
+std::vector<T> PairingHeap<T, Compare>::toSortedVector() const {
+    PairingHeap copy(*this);
+    std::vector<T> result;
+    result.reserve(copy.size());
+    while (!copy.empty()) {
+        result.push_back(copy.dequeueAndReturn());
+    }
+    return result;
+}
+
+// Check integrity
+template<class T, class Compare>
+bool PairingHeap<T, Compare>::checkIntegrity() const {
+    if (root != nullptr && (root->prev != nullptr || root->next != nullptr)) {
+        return false;
+    }
+    size_t counted = 0;
+    bool valid = true;
+    visitNodes(root, [&](Node* node) {
+        ++counted;
+        Node* previous = node;
+        for (Node* child = node->child; child != nullptr; child = child->next) {
+            if (child->prev != previous || order(node->value, child->value)) {
+                valid = false;
+            }
+            previous = child;
+        }
+    });
+    return valid && counted == heapSize;
+}
+
+#endif // PAIRINGHEAP_H
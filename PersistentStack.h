@@ -0,0 +1,518 @@
+#ifndef PERSISTENTSTACK_H
+#define PERSISTENTSTACK_H
+
+#include "Stack.h"
+#include <atomic>
+
+// Pilha persistente (imutável).
+// push e pop não alteram a pilha atual: retornam uma nova versão que
+// compartilha a cauda com a original. Os nós têm contagem de referências,
+// então cópias são O(1) e várias versões podem coexistir.
+template<class T>
+class PersistentStack {
+private:
+    class Node {
+    public:
+        T data;
+        Node* next;
+        mutable std::atomic<size_t> refCount;
+
+        Node(const T& value, Node* nextNode);
+        Node(T&& value, Node* nextNode);
+
+        template<typename... Args>
+        Node(Node* nextNode, Args&&... args);
+
+        // Destrutor
+        ~Node() = default;
+    };
+
+    Node* topNode;
+    size_t stackSize;
+
+    // Construtor interno a partir de um nó já referenciado
+    PersistentStack(Node* node, size_t size);
+
+    // Contagem de referências
+    static void retain(Node* node);
+    static void release(Node* node);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor padrão
+    PersistentStack();
+
+    // Construtor de cópia (O(1): compartilha os nós)
+    PersistentStack(const PersistentStack& other);
+
+    // Construtor de movimento
+    PersistentStack(PersistentStack&& other) noexcept;
+
+    // Construtor com lista de inicialização (último elemento no topo)
+    PersistentStack(std::initializer_list<T> init);
+
+    // Construtor a partir de uma Stack mutável
+    explicit PersistentStack(const Stack<T>& stack);
+
+    // Destrutor
+    ~PersistentStack();
+
+    // ==================== OPERADORES DE ATRIBUIÇÃO ====================
+
+    PersistentStack& operator=(const PersistentStack& other);
+    PersistentStack& operator=(PersistentStack&& other) noexcept;
+
+    // ==================== MÉTODOS PRINCIPAIS ====================
+
+    // Retorna nova versão com elemento no topo
+    PersistentStack push(const T& value) const;
+    PersistentStack push(T&& value) const;
+
+    // Retorna nova versão com elemento construído in-place no topo
+    template<typename... Args>
+    PersistentStack emplace(Args&&... args) const;
+
+    // Retorna nova versão sem o elemento do topo
+    PersistentStack pop() const;
+
+    // Acessa elemento do topo
+    const T& top() const;
+
+    // ==================== MÉTODOS DE CONSULTA ====================
+
+    bool empty() const;
+    size_t size() const;
+    bool contains(const T& value) const;
+    size_t count(const T& value) const;
+
+    // Acessa elemento por índice (0 = topo)
+    const T& at(size_t index) const;
+
+    // Verifica se duas versões compartilham o mesmo topo
+    bool sharesTopWith(const PersistentStack& other) const;
+
+    // ==================== OPERAÇÕES DE MANIPULAÇÃO ====================
+
+    // Descarta a referência desta versão (as demais não são afetadas)
+    void clear();
+
+    void swap(PersistentStack& other) noexcept;
+
+    // ==================== MÉTODOS FUNCIONAIS ====================
+
+    void forEach(std::function<void(const T&)> func) const;
+    bool allOf(std::function<bool(const T&)> predicate) const;
+    bool anyOf(std::function<bool(const T&)> predicate) const;
+
+    // ==================== CONVERSÕES ====================
+
+    // Converte para vetor (topo primeiro)
+    std::vector<T> toVector() const;
+
+    // Converte para vetor invertido (base primeiro)
+    std::vector<T> toVectorReversed() const;
+
+    // Converte para Stack mutável
+    Stack<T> toStack() const;
+
+    // ==================== OPERADORES DE COMPARAÇÃO ====================
+
+    bool operator==(const PersistentStack& other) const;
+    bool operator!=(const PersistentStack& other) const;
+
+    // ==================== OPERADOR DE SAÍDA ====================
+
+    template<class U>
+    friend std::ostream& operator<<(std::ostream& os, const PersistentStack<U>& stack);
+
+    // ==================== MÉTODOS DE DEBUG ====================
+
+    void print() const;
+    bool checkIntegrity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtores da classe Node (nasce com uma referência)
+template<class T>
+PersistentStack<T>::Node::Node(const T& value, Node* nextNode)
+    : data(value), next(nextNode), refCount(1) {}
+
+template<class T>
+PersistentStack<T>::Node::Node(T&& value, Node* nextNode)
+    : data(std::move(value)), next(nextNode), refCount(1) {}
+
+template<class T>
+template<typename... Args>
+PersistentStack<T>::Node::Node(Node* nextNode, Args&&... args)
+    : data(std::forward<Args>(args)...), next(nextNode), refCount(1) {}
+
+// Retain / release
+template<class T>
+void PersistentStack<T>::retain(Node* node) {
+    if (node != nullptr) {
+        node->refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Release iterativo: evita recursão profunda ao liberar cadeias longas
+template<class T>
+void PersistentStack<T>::release(Node* node) {
+    while (node != nullptr && node->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// Construtor interno
+template<class T>
+PersistentStack<T>::PersistentStack(Node* node, size_t size) : topNode(node), stackSize(size) {}
+
+// Construtor padrão
+template<class T>
+PersistentStack<T>::PersistentStack() : topNode(nullptr), stackSize(0) {}
+
+// Construtor de cópia
+template<class T>
+PersistentStack<T>::PersistentStack(const PersistentStack& other)
+    : topNode(other.topNode), stackSize(other.stackSize) {
+    retain(topNode);
+}
+
+// Construtor de movimento
+template<class T>
+PersistentStack<T>::PersistentStack(PersistentStack&& other) noexcept
+    : topNode(other.topNode), stackSize(other.stackSize) {
+    other.topNode = nullptr;
+    other.stackSize = 0;
+}
+
+// Construtor com lista de inicialização
+template<class T>
+PersistentStack<T>::PersistentStack(std::initializer_list<T> init) : topNode(nullptr), stackSize(0) {
+    try {
+        for (const auto& item : init) {
+            topNode = new Node(item, topNode);
+            ++stackSize;
+        }
+    } catch (...) {
+        release(topNode); // O destrutor não roda se o construtor lança
+        throw;
+    }
+}
+
+// Construtor a partir de Stack
+template<class T>
+PersistentStack<T>::PersistentStack(const Stack<T>& stack) : topNode(nullptr), stackSize(0) {
+    std::vector<T> items = stack.toVectorReversed();
+    try {
+        for (auto& item : items) {
+            topNode = new Node(std::move(item), topNode);
+            ++stackSize;
+        }
+    } catch (...) {
+        release(topNode);
+        throw;
+    }
+}
+
+// Destrutor
+template<class T>
+PersistentStack<T>::~PersistentStack() {
+    release(topNode);
+}
+
+// Operador de atribuição por cópia
+template<class T>
+PersistentStack<T>& PersistentStack<T>::operator=(const PersistentStack& other) {
+    if (this != &other) {
+        retain(other.topNode);
+        release(topNode);
+        topNode = other.topNode;
+        stackSize = other.stackSize;
+    }
+    return *this;
+}
+
+// Operador de atribuição por movimento
+template<class T>
+PersistentStack<T>& PersistentStack<T>::operator=(PersistentStack&& other) noexcept {
+    if (this != &other) {
+        release(topNode);
+        topNode = other.topNode;
+        stackSize = other.stackSize;
+        other.topNode = nullptr;
+        other.stackSize = 0;
+    }
+    return *this;
+}
+
+// Push: novo nó aponta para o topo atual, que ganha uma referência.
+// O nó é criado antes do retain: se a cópia ou a alocação lançar, a
+// contagem da cauda não muda
+template<class T>
+PersistentStack<T> PersistentStack<T>::push(const T& value) const {
+    Node* node = new Node(value, topNode);
+    retain(topNode);
+    return PersistentStack(node, stackSize + 1);
+}
+
+template<class T>
+PersistentStack<T> PersistentStack<T>::push(T&& value) const {
+    Node* node = new Node(std::move(value), topNode);
+    retain(topNode);
+    return PersistentStack(node, stackSize + 1);
+}
+
+// Emplace
+template<class T>
+template<typename... Args>
+PersistentStack<T> PersistentStack<T>::emplace(Args&&... args) const {
+    Node* node = new Node(topNode, std::forward<Args>(args)...);
+    retain(topNode);
+    return PersistentStack(node, stackSize + 1);
+}
+
+// Pop
+template<class T>
+PersistentStack<T> PersistentStack<T>::pop() const {
+    if (empty()) {
+        throw std::underflow_error("Stack is empty");
+    }
+    retain(topNode->next);
+    return PersistentStack(topNode->next, stackSize - 1);
+}
+
+// Top
+template<class T>
+const T& PersistentStack<T>::top() const {
+    if (empty()) {
+        throw std::underflow_error("Stack is empty");
+    }
+    return topNode->data;
+}
+
+// Empty
+template<class T>
+bool PersistentStack<T>::empty() const {
+    return topNode == nullptr;
+}
+
+// Size
+template<class T>
+size_t PersistentStack<T>::size() const {
+    return stackSize;
+}
+
+// Contains
+template<class T>
+bool PersistentStack<T>::contains(const T& value) const {
+    Node* current = topNode;
+    while (current != nullptr) {
+        if (current->data == value) {
+            return true;
+        }
+        current = current->next;
+    }
+    return false;
+}
+
+// Count
+template<class T>
+size_t PersistentStack<T>::count(const T& value) const {
+    size_t counter = 0;
+    Node* current = topNode;
+    while (current != nullptr) {
+        if (current->data == value) {
+            ++counter;
+        }
+        current = current->next;
+    }
+    return counter;
+}
+
+// At
+template<class T>
+const T& PersistentStack<T>::at(size_t index) const {
+    if (index >= stackSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    Node* current = topNode;
+    for (size_t i = 0; i < index; ++i) {
+        current = current->next;
+    }
+    return current->data;
+}
+
+// Shares top
+template<class T>
+bool PersistentStack<T>::sharesTopWith(const PersistentStack& other) const {
+    return topNode == other.topNode;
+}
+
+// Clear
+template<class T>
+void PersistentStack<T>::clear() {
+    release(topNode);
+    topNode = nullptr;
+    stackSize = 0;
+}
+
+// Swap
+template<class T>
+void PersistentStack<T>::swap(PersistentStack& other) noexcept {
+    std::swap(topNode, other.topNode);
+    std::swap(stackSize, other.stackSize);
+}
+
+// For each
+template<class T>
+void PersistentStack<T>::forEach(std::function<void(const T&)> func) const {
+    Node* current = topNode;
+    while (current != nullptr) {
+        func(current->data);
+        current = current->next;
+    }
+}
+
+// All of
+template<class T>
+bool PersistentStack<T>::allOf(std::function<bool(const T&)> predicate) const {
+    Node* current = topNode;
+    while (current != nullptr) {
+        if (!predicate(current->data)) {
+            return false;
+        }
+        current = current->next;
+    }
+    return true;
+}
+
+// Any of
+template<class T>
+bool PersistentStack<T>::anyOf(std::function<bool(const T&)> predicate) const {
+    Node* current = topNode;
+    while (current != nullptr) {
+        if (predicate(current->data)) {
+            return true;
+        }
+        current = current->next;
+    }
+    return false;
+}
+
+// To vector
+template<class T>
+std::vector<T> PersistentStack<T>::toVector() const {
+    std::vector<T> result;
+    result.reserve(stackSize);
+    Node* current = topNode;
+    while (current != nullptr) {
+        result.push_back(current->data);
+        current = current->next;
+    }
+    return result;
+}
+
+// To vector reversed
+template<class T>
+std::vector<T> PersistentStack<T>::toVectorReversed() const {
+    std::vector<T> result = toVector();
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+// To stack
+template<class T>
+Stack<T> PersistentStack<T>::toStack() const {
+    Stack<T> result;
+    std::vector<T> items = toVectorReversed();
+    for (auto& item : items) {
+        result.push(std::move(item));
+    }
+    return result;
+}
+
+// Operator == (caudas compartilhadas encerram a comparação)
+template<class T>
+bool PersistentStack<T>::operator==(const PersistentStack& other) const {
+    if (stackSize != other.stackSize) {
+        return false;
+    }
+
+    Node* current1 = topNode;
+    Node* current2 = other.topNode;
+
+    while (current1 != current2) {
+        if (current1->data != current2->data) {
+            return false;
+        }
+        current1 = current1->next;
+        current2 = current2->next;
+    }
+
+    return true;
+}
+
+// Operator !=
+template<class T>
+bool PersistentStack<T>::operator!=(const PersistentStack& other) const {
+    return !(*this == other);
+}
+
+// Print
+template<class T>
+void PersistentStack<T>::print() const {
+    std::cout << "PersistentStack [size=" << stackSize << "]: ";
+    if (empty()) {
+        std::cout << "(empty)";
+    } else {
+        std::cout << "TOP -> ";
+        Node* current = topNode;
+        while (current != nullptr) {
+            std::cout << current->data;
+            if (current->next != nullptr) {
+                std::cout << " -> ";
+            }
+            current = current->next;
+        }
+        std::cout << " -> BASE";
+    }
+    std::cout << std::endl;
+}
+
+// Check integrity
+template<class T>
+bool PersistentStack<T>::checkIntegrity() const {
+    size_t count = 0;
+    Node* current = topNode;
+    while (current != nullptr) {
+        if (current->refCount.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        ++count;
+        current = current->next;
+    }
+    return count == stackSize;
+}
+
+// Operador de saída
+template<class T>
+std::ostream& operator<<(std::ostream& os, const PersistentStack<T>& stack) {
+    os << "[";
+    typename PersistentStack<T>::Node* current = stack.topNode;
+    bool first = true;
+    while (current != nullptr) {
+        if (!first) {
+            os << ", ";
+        }
+        os << current->data;
+        first = false;
+        current = current->next;
+    }
+    os << "]";
+    return os;
+}
+
+#endif // PERSISTENTSTACK_H
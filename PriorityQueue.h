@@ -0,0 +1,535 @@
+#ifndef PRIORITYQUEUE_H
+#define PRIORITYQUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "MemoryUsage.h"
+
+// Fila de prioridade sobre heap d-ário (Arity filhos por nó) em vetor.
+// Com Arity 4 o heap tem metade da altura do binário e os filhos de um nó
+// são contíguos (cabem em uma ou duas linhas de cache), o que reduz as
+// falhas de cache do dequeue. Os valores ficam num vetor só deles e os
+// ids dos handles num vetor paralelo, então as comparações percorrem
+// memória densa.
+//
+// Compare segue a convenção de std::priority_queue: order(a, b) == true se
+// a tem prioridade menor que b; com std::less, front() é o maior elemento
+// e com std::greater, o menor (Dijkstra).
+//
+// enqueue retorna um Handle que identifica o elemento enquanto ele estiver
+// na fila: decreaseKey/update/erase o localizam em O(1) pela tabela de
+// posições e reorganizam o heap em O(log n). Handles de elementos que já
+// saíram são detectados (geração por slot) e lançam invalid_argument.
+template<class T, class Compare = std::less<T>, size_t Arity = 4>
+class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+public:
+    // Identifica um elemento da fila (copiável, sem posse)
+    class Handle {
+        friend class PriorityQueue;
+
+    private:
+        size_t id;
+        size_t generation;
+
+        Handle(size_t slotId, size_t slotGeneration) : id(slotId), generation(slotGeneration) {}
+
+    public:
+        // Handle inválido
+        Handle() : id(std::numeric_limits<size_t>::max()), generation(0) {}
+
+        bool operator==(const Handle& other) const { return id == other.id && generation == other.generation; }
+        bool operator!=(const Handle& other) const { return !(*this == other); }
+    };
+
+private:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    std::vector<T> values;            // Heap
+    std::vector<size_t> ids;          // ids[i] = slot de values[i] na tabela de posições
+    std::vector<size_t> positions;    // id -> índice no heap (npos se livre)
+    std::vector<size_t> generations;  // id -> geração atual (invalida handles antigos)
+    std::vector<size_t> freeIds;
+    Compare order;
+
+    // Métodos auxiliares privados
+    size_t allocateId();
+    void releaseId(size_t id);
+    size_t indexOf(const Handle& handle) const;  // Lança se o handle for inválido
+
+    // Coloca value (com seu id) em index e atualiza a tabela de posições
+    void place(size_t index, T&& value, size_t id);
+
+    // Buraco: o elemento em index é retirado e os vizinhos deslizam até
+    // achar sua posição (um move por nível em vez de um swap)
+    void siftUp(size_t index);
+
+    // Desce o buraco até uma folha pelo melhor filho e depois sobe o
+    // elemento (bottom-up de Floyd: o elemento que desce costuma voltar a
+    // uma folha, então compará-lo a cada nível quase sempre é desperdício)
+    void siftDown(size_t index);
+    void restore(size_t index);  // siftUp ou siftDown, conforme o caso
+
+    void removeAt(size_t index);
+    void heapify();
+
+    template<typename... Args>
+    Handle insert(Args&&... args);
+
+public:
+    // ==================== CONSTRUTORES ====================
+    // Construtor padrão
+    PriorityQueue();
+
+    // Construtor com comparador
+    explicit PriorityQueue(const Compare& compare);
+
+    // Construtor com lista de inicialização (heapify em O(n))
+    PriorityQueue(std::initializer_list<T> init, const Compare& compare = Compare());
+
+    // Construtor a partir de intervalo de iteradores (heapify em O(n))
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    PriorityQueue(InputIt first, InputIt last, const Compare& compare = Compare());
+
+    // ==================== MÉTODOS PRINCIPAIS ====================
+
+    // Adiciona elemento; retorna o handle para decreaseKey/update/erase
+    Handle enqueue(const T& value);
+    Handle enqueue(T&& value);
+
+    template<typename... Args>
+    Handle emplace(Args&&... args);
+
+    // Remove o elemento de maior prioridade
+    void dequeue();
+
+    // Remove e retorna o elemento de maior prioridade (movendo)
+    T dequeueAndReturn();
+
+    // Tenta remover o elemento de maior prioridade para out; false se vazia
+    bool tryDequeue(T& out);
+
+    // Elemento de maior prioridade (só leitura: alterá-lo quebraria o heap)
+    const T& front() const;
+
+    // ==================== HANDLES ====================
+
+    // O elemento do handle ainda está na fila?
+    bool contains(const Handle& handle) const;
+
+    // Valor atual do elemento do handle
+    const T& get(const Handle& handle) const;
+
+    // Aumenta a prioridade do elemento (o "decrease-key" de um heap de
+    // mínimo); lança invalid_argument se value tiver prioridade menor
+    void decreaseKey(const Handle& handle, const T& value);
+    void decreaseKey(const Handle& handle, T&& value);
+
+    // Troca o valor do elemento em qualquer direção
+    void update(const Handle& handle, const T& value);
+    void update(const Handle& handle, T&& value);
+
+    // Remove o elemento do handle e retorna seu valor
+    T erase(const Handle& handle);
+
+    // ==================== MÉTODOS DE CONSULTA ====================
+
+    bool empty() const;
+    size_t size() const;
+
+    // Memória ocupada: heap, tabelas de handles e DeepSize<T>
+    MemoryUsage memoryUsage() const;
+
+    // ==================== OPERAÇÕES DE MANIPULAÇÃO ====================
+
+    // Garante espaço para minCount elementos sem realocar
+    void reserve(size_t minCount);
+
+    // Limpa a fila (invalida todos os handles)
+    void clear();
+
+    // Troca conteúdo com outra fila (handles acompanham os elementos)
+    void swap(PriorityQueue& other) noexcept;
+
+    // ==================== CONVERSÕES ====================
+
+    // Elementos em ordem de prioridade (maior primeiro), sem alterar a fila
+    std::vector<T> toSortedVector() const;
+
+    // ==================== MÉTODOS DE DEBUG ====================
+
+    // Verifica a propriedade de heap e a tabela de posições
+    bool checkIntegrity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtores
+template<class T, class Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue() : order() {}
+
+template<class T, class Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(const Compare& compare) : order(compare) {}
+
+template<class T, class Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(std::initializer_list<T> init, const Compare& compare)
+    : PriorityQueue(init.begin(), init.end(), compare) {}
+
+template<class T, class Compare, size_t Arity>
+template<typename InputIt, typename>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(InputIt first, InputIt last, const Compare& compare)
+    : order(compare) {
+    for (; first != last; ++first) {
+        size_t id = values.size();
+        values.push_back(*first);
+        ids.push_back(id);
+        positions.push_back(id);
+        generations.push_back(0);
+    }
+    heapify();
+}
+
+// Tabela de handles
+template<class T, class Compare, size_t Arity>
+size_t PriorityQueue<T, Compare, Arity>::allocateId() {
+    if (!freeIds.empty()) {
+        size_t id = freeIds.back();
+        freeIds.pop_back();
+        return id;
+    }
+    positions.push_back(npos);
+    generations.push_back(0);
+    return positions.size() - 1;
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::releaseId(size_t id) {
+    positions[id] = npos;
+    ++generations[id];
+    freeIds.push_back(id);
+}
+
+template<class T, class Compare, size_t Arity>
+size_t PriorityQueue<T, Compare, Arity>::indexOf(const Handle& handle) const {
+    if (!contains(handle)) {
+        throw std::invalid_argument("Invalid priority queue handle");
+    }
+    return positions[handle.id];
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::place(size_t index, T&& value, size_t id) {
+    values[index] = std::move(value);
+    ids[index] = id;
+    positions[id] = index;
+}
+
+// Sift up
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftUp(size_t index) {
+    T moving = std::move(values[index]);
+    size_t movingId = ids[index];
+    while (index > 0) {
+        size_t parent = (index - 1) / Arity;
+        if (!order(values[parent], moving)) {
+            break;
+        }
+        place(index, std::move(values[parent]), ids[parent]);
+        index = parent;
+    }
+    place(index, std::move(moving), movingId);
+}
+
+// Sift down: escolhe o filho de maior prioridade entre os Arity contíguos
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftDown(size_t index) {
+    size_t count = values.size();
+    size_t start = index;
+    T moving = std::move(values[index]);
+    size_t movingId = ids[index];
+
+    while (true) {
+        size_t firstChild = index * Arity + 1;
+        if (firstChild >= count) {
+            break;
+        }
+        size_t lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+        size_t best = firstChild;
+        for (size_t child = firstChild + 1; child < lastChild; ++child) {
+            if (order(values[best], values[child])) {
+                best = child;
+            }
+        }
+        place(index, std::move(values[best]), ids[best]);
+        index = best;
+    }
+
+    while (index > start) {
+        size_t parent = (index - 1) / Arity;
+        if (!order(values[parent], moving)) {
+            break;
+        }
+        place(index, std::move(values[parent]), ids[parent]);
+        index = parent;
+    }
+    place(index, std::move(moving), movingId);
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::restore(size_t index) {
+    if (index > 0 && order(values[(index - 1) / Arity], values[index])) {
+        siftUp(index);
+    } else {
+        siftDown(index);
+    }
+}
+
+// Remove o elemento em index: o último ocupa o lugar e é reposicionado
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::removeAt(size_t index) {
+    releaseId(ids[index]);
+    size_t last = values.size() - 1;
+    if (index != last) {
+        place(index, std::move(values[last]), ids[last]);
+    }
+    values.pop_back();
+    ids.pop_back();
+    if (index < values.size()) {
+        restore(index);
+    }
+}
+
+// Heapify de Floyd: siftDown dos pais, do último ao primeiro
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::heapify() {
+    if (values.size() < 2) {
+        return;
+    }
+    for (size_t index = (values.size() - 2) / Arity + 1; index-- > 0;) {
+        siftDown(index);
+    }
+}
+
+// Inserção
+template<class T, class Compare, size_t Arity>
+template<typename... Args>
+typename PriorityQueue<T, Compare, Arity>::Handle PriorityQueue<T, Compare, Arity>::insert(Args&&... args) {
+    size_t id = allocateId();
+    try {
+        ids.push_back(id);
+        try {
+            values.emplace_back(std::forward<Args>(args)...);
+        } catch (...) {
+            ids.pop_back();
+            throw;
+        }
+    } catch (...) {
+        releaseId(id);
+        throw;
+    }
+    siftUp(values.size() - 1);
+    return Handle(id, generations[id]);
+}
+
+template<class T, class Compare, size_t Arity>
+typename PriorityQueue<T, Compare, Arity>::Handle PriorityQueue<T, Compare, Arity>::enqueue(const T& value) {
+    return insert(value);
+}
+
+template<class T, class Compare, size_t Arity>
+typename PriorityQueue<T, Compare, Arity>::Handle PriorityQueue<T, Compare, Arity>::enqueue(T&& value) {
+    return insert(std::move(value));
+}
+
+template<class T, class Compare, size_t Arity>
+template<typename... Args>
+typename PriorityQueue<T, Compare, Arity>::Handle PriorityQueue<T, Compare, Arity>::emplace(Args&&... args) {
+    return insert(std::forward<Args>(args)...);
+}
+
+// Remoção
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::dequeue() {
+    if (empty()) {
+        throw std::underflow_error("Priority queue is empty");
+    }
+    removeAt(0);
+}
+
+template<class T, class Compare, size_t Arity>
+T PriorityQueue<T, Compare, Arity>::dequeueAndReturn() {
+    if (empty()) {
+        throw std::underflow_error("Priority queue is empty");
+    }
+    T value = std::move(values[0]);
+    removeAt(0);
+    return value;
+}
+
+template<class T, class Compare, size_t Arity>
+bool PriorityQueue<T, Compare, Arity>::tryDequeue(T& out) {
+    if (empty()) {
+        return false;
+    }
+    out = std::move(values[0]);
+    removeAt(0);
+    return true;
+}
+
+template<class T, class Compare, size_t Arity>
+const T& PriorityQueue<T, Compare, Arity>::front() const {
+    if (empty()) {
+        throw std::underflow_error("Priority queue is empty");
+    }
+    return values[0];
+}
+
+// Handles
+template<class T, class Compare, size_t Arity>
+bool PriorityQueue<T, Compare, Arity>::contains(const Handle& handle) const {
+    return handle.id < positions.size() && positions[handle.id] != npos &&
+           generations[handle.id] == handle.generation;
+}
+
+template<class T, class Compare, size_t Arity>
+const T& PriorityQueue<T, Compare, Arity>::get(const Handle& handle) const {
+    return values[indexOf(handle)];
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::decreaseKey(const Handle& handle, const T& value) {
+    decreaseKey(handle, T(value));
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::decreaseKey(const Handle& handle, T&& value) {
+    size_t index = indexOf(handle);
+    if (order(value, values[index])) {
+        throw std::invalid_argument("decreaseKey would lower the priority");
+    }
+    values[index] = std::move(value);
+    siftUp(index);
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::update(const Handle& handle, const T& value) {
+    update(handle, T(value));
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::update(const Handle& handle, T&& value) {
+    size_t index = indexOf(handle);
+    values[index] = std::move(value);
+    restore(index);
+}
+
+template<class T, class Compare, size_t Arity>
+T PriorityQueue<T, Compare, Arity>::erase(const Handle& handle) {
+    size_t index = indexOf(handle);
+    T value = std::move(values[index]);
+    removeAt(index);
+    return value;
+}
+
+// Consulta
+template<class T, class Compare, size_t Arity>
+bool PriorityQueue<T, Compare, Arity>::empty() const {
+    return values.empty();
+}
+
+template<class T, class Compare, size_t Arity>
+size_t PriorityQueue<T, Compare, Arity>::size() const {
+    return values.size();
+}
+
+// Memory usage: o vetor de valores é o "nó"; ids e tabelas de handles são overhead
+template<class T, class Compare, size_t Arity>
+MemoryUsage PriorityQueue<T, Compare, Arity>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    usage.nodeBytes = values.capacity() * sizeof(T);
+    usage.payloadBytes = values.size() * sizeof(T);
+    if (values.capacity() > 0) {
+        usage.slackBytes = allocationSlack(values.capacity() * sizeof(T));
+    }
+    for (const std::vector<size_t>* table : {&ids, &positions, &generations, &freeIds}) {
+        if (table->capacity() > 0) {
+            usage.overheadBytes += allocationSize(table->capacity() * sizeof(size_t));
+        }
+    }
+    if (DeepSize<T>::indirect) {
+        for (const T& value : values) {
+            usage.deepBytes += DeepSize<T>::of(value);
+        }
+    }
+    return usage;
+}
+
+// Manipulação
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::reserve(size_t minCount) {
+    values.reserve(minCount);
+    ids.reserve(minCount);
+    positions.reserve(minCount);
+    generations.reserve(minCount);
+}
+
+// Clear: as gerações avançam para que handles antigos não casem com ids reutilizados
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::clear() {
+    for (size_t id : ids) {
+        releaseId(id);
+    }
+    values.clear();
+    ids.clear();
+}
+
+template<class T, class Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::swap(PriorityQueue& other) noexcept {
+    using std::swap;
+    values.swap(other.values);
+    ids.swap(other.ids);
+    positions.swap(other.positions);
+    generations.swap(other.generations);
+    freeIds.swap(other.freeIds);
+    swap(order, other.order);
+}
+
+// Conversões: copia o heap e esvazia a cópia
+template<class T, class Compare, size_t Arity>
+std::vector<T> PriorityQueue<T, Compare, Arity>::toSortedVector() const {
+    PriorityQueue copy(*this);
+    std::vector<T> result;
+    result.reserve(copy.size());
+    while (!copy.empty()) {
+        result.push_back(copy.dequeueAndReturn());
+    }
+    return result;
+}
+
+// Check integrity
+template<class T, class Compare, size_t Arity>
+bool PriorityQueue<T, Compare, Arity>::checkIntegrity() const {
+    if (ids.size() != values.size()) {
+        return false;
+    }
+    for (size_t index = 0; index < values.size(); ++index) {
+        if (index > 0 && order(values[(index - 1) / Arity], values[index])) {
+            return false;
+        }
+        size_t id = ids[index];
+        if (id >= positions.size() || positions[id] != index) {
+            return false;
+        }
+    }
+    return positions.size() == values.size() + freeIds.size();
+}
+
+#endif // PRIORITYQUEUE_H
@@ -7,227 +7,424 @@
 #include <functional>
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <new>
+#include "OutputBuffer.h"
+#include "MemoryUsage.h"
 
+// Fila FIFO sobre buffer circular contíguo.
+// A capacidade é sempre potência de dois: a posição i fica em
+// buffer[(head + i) & (capacity - 1)]. O buffer dobra quando enche
+// (O(1) amortizado) e não é liberado ao esvaziar, então uma fila em
+// regime estável não chama o alocador. shrinkToFit() devolve o excesso.
 template<class T>
 class Queue {
 private:
-    class Node {
-    public:
-        T data;
-        Node* next;
-        
-        Node();
-        Node(const T& value);
-        Node(T&& value);
-        
-        // Destrutor
-        ~Node() = default;
-    };
-    
-    Node* frontNode;    // Primeiro elemento (para remoção)
-    Node* rearNode;     // Último elemento (para inserção)
+    static constexpr size_t minCapacity = 8;
+
+    T* buffer;              // Memória bruta para bufferCapacity elementos
+    size_t bufferCapacity;  // 0 ou potência de dois
+    size_t head;            // Posição do primeiro elemento (para remoção)
     size_t queueSize;
-    
+
+    // Métodos auxiliares privados
+    T* slot(size_t index) const;    // Endereço do elemento index (sem verificação)
+    static T* allocateBuffer(size_t capacity);
+    static void deallocateBuffer(T* storage, size_t capacity);
+    void reallocate(size_t newCapacity);
+    void destroyAll();
+
+    // Constrói no final; se estiver cheia, constrói no buffer novo antes de
+    // mover os antigos (args pode referenciar um elemento da própria fila)
+    template<typename... Args>
+    void constructBack(Args&&... args);
+
+    // Remove do final os elementos a partir de newSize
+    void truncate(size_t newSize);
+
+    // Descarta os count primeiros elementos (já destruídos)
+    void advanceHead(size_t count);
+
+    // Reserva total posições em target se o container tiver reserve()
+    template<typename Container>
+    static auto reserveIn(Container& target, size_t total, int) -> decltype(target.reserve(total), void());
+    template<typename Container>
+    static void reserveIn(Container&, size_t, long) {}
+
+    // Escreve os elementos no buffer (usado por operator<<, print e writeTo)
+    void writeElements(OutputBuffer& out, size_t previewCount) const;
+
 public:
     // ==================== CONSTRUTORES E DESTRUTOR ====================
     // Construtor padrão
     Queue();
-    
+
     // Construtor de cópia
     Queue(const Queue& other);
-    
+
     // Construtor de movimento
     Queue(Queue&& other) noexcept;
-    
+
     // Construtor com lista de inicialização
     Queue(std::initializer_list<T> init);
-    
+
+    // Construtor a partir de intervalo de iteradores
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Queue(InputIt first, InputIt last);
+
     // Destrutor
     ~Queue();
-    
+
     // ==================== OPERADORES DE ATRIBUIÇÃO ====================
-    
+
     // Operador de atribuição por cópia
     Queue& operator=(const Queue& other);
-    
+
     // Operador de atribuição por movimento
     Queue& operator=(Queue&& other) noexcept;
-    
+
     // ==================== MÉTODOS PRINCIPAIS ====================
-    
+
     // Adiciona elemento no final da fila
     void enqueue(const T& value);
-    
+
     // Adiciona elemento no final da fila (versão move)
     void enqueue(T&& value);
-    
+
     // Constrói elemento in-place no final da fila
     template<typename... Args>
     void emplace(Args&&... args);
-    
+
+    // Enfileira um intervalo em lote (reserva espaço uma vez para iteradores de avanço)
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void enqueue(InputIt first, InputIt last);
+
+    // Enfileira um intervalo inteiro (move os elementos se receber rvalue)
+    template<typename Range>
+    void enqueueRange(Range&& range);
+
+    // Substitui o conteúdo
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
+
     // Remove elemento do início da fila
     void dequeue();
-    
-    // Remove e retorna elemento do início da fila
+
+    // Remove e retorna elemento do início da fila (movendo, sem cópia)
     T dequeueAndReturn();
-    
+
+    // Tenta remover o primeiro elemento para out; retorna false se vazia
+    bool tryDequeue(T& out);
+
+    // Move até maxCount elementos da frente para out, avançando head uma
+    // única vez; retorna quantos foram removidos (0 se vazia)
+    template<typename OutputIt>
+    size_t dequeueBulk(OutputIt out, size_t maxCount);
+
+    // Move todos os elementos para o final de target (push_back), em ordem;
+    // retorna quantos foram removidos
+    template<typename Container>
+    size_t drainTo(Container& target);
+
     // Acessa elemento do início da fila (referência)
     T& front();
-    
+
     // Acessa elemento do início da fila (const)
     const T& front() const;
-    
+
     // Acessa elemento do final da fila (referência)
     T& rear();
-    
+
     // Acessa elemento do final da fila (const)
     const T& rear() const;
-    
+
     // ==================== MÉTODOS DE CONSULTA ====================
-    
+
     // Verifica se está vazia
     bool empty() const;
-    
+
     // Retorna o tamanho
     size_t size() const;
-    
+
+    // Retorna quantos elementos cabem sem realocar
+    size_t capacity() const;
+
+    // Memória ocupada: buffer, payload, slack do alocador e DeepSize<T>
+    MemoryUsage memoryUsage() const;
+
     // Verifica se contém um elemento
     bool contains(const T& value) const;
-    
+
     // Conta ocorrências de um elemento
     size_t count(const T& value) const;
-    
-    // Acessa elemento por índice (0 = frente)
+
+    // Acessa elemento por índice em O(1) (0 = frente)
     T& at(size_t index);
-    
+
     // Acessa elemento por índice (const)
     const T& at(size_t index) const;
-    
+
+    // ==================== CAPACIDADE ====================
+
+    // Garante espaço para minCount elementos sem realocar
+    void reserve(size_t minCount);
+
+    // Reduz o buffer à menor potência de dois que comporta os elementos
+    // (libera o buffer se a fila estiver vazia)
+    void shrinkToFit();
+
     // ==================== OPERAÇÕES DE MANIPULAÇÃO ====================
-    
-    // Limpa toda a fila
+
+    // Limpa toda a fila (mantém o buffer)
     void clear();
-    
+
     // Troca conteúdo com outra fila
     void swap(Queue& other) noexcept;
-    
+
     // Remove todas as ocorrências de um valor
     size_t removeAll(const T& value);
-    
+
     // Remove primeira ocorrência de um valor
     bool removeFirst(const T& value);
-    
+
     // Duplica o elemento da frente
     void duplicate();
-    
+
     // Inverte a fila
     void reverse();
-    
+
     // ==================== MÉTODOS DE BUSCA ====================
-    
+
     // Encontra índice da primeira ocorrência
     int findFirst(const T& value) const;
-    
+
     // Encontra índice da última ocorrência
     int findLast(const T& value) const;
-    
+
     // ==================== MÉTODOS FUNCIONAIS ====================
-    
+
     // Aplica função a todos os elementos
     void forEach(std::function<void(T&)> func);
-    
+
     // Aplica função a todos os elementos (const)
     void forEach(std::function<void(const T&)> func) const;
-    
+
     // Verifica se todos os elementos satisfazem condição
     bool allOf(std::function<bool(const T&)> predicate) const;
-    
+
     // Verifica se algum elemento satisfaz condição
     bool anyOf(std::function<bool(const T&)> predicate) const;
-    
+
     // ==================== CONVERSÕES ====================
-    
+
     // Converte para vetor (frente primeiro)
     std::vector<T> toVector() const;
-    
+
     // Converte para vetor invertido (final primeiro)
     std::vector<T> toVectorReversed() const;
-    
+
     // ==================== OPERADORES DE COMPARAÇÃO ====================
-    
+
     bool operator==(const Queue& other) const;
     bool operator!=(const Queue& other) const;
-    
+
     // ==================== OPERADOR DE SAÍDA ====================
-    
+
     template<class U>
     friend std::ostream& operator<<(std::ostream& os, const Queue<U>& queue);
-    
+
     // ==================== MÉTODOS DE DEBUG ====================
-    
+
     // Imprime estrutura da fila
     void print() const;
-    
+
+    // Escrita bufferizada no formato de operator<<
+    // (previewCount > 0 mostra só os primeiros e últimos previewCount elementos)
+    void writeTo(std::ostream& os, size_t previewCount = 0) const;
+    void writeTo(int fd, size_t previewCount = 0) const;
+
     // Verifica integridade da estrutura
     bool checkIntegrity() const;
 };
 
 // ==================== IMPLEMENTAÇÕES INLINE ====================
 
-// Construtores da classe Node
+// Endereço do elemento index: máscara em vez de módulo
+template<class T>
+T* Queue<T>::slot(size_t index) const {
+    return buffer + ((head + index) & (bufferCapacity - 1));
+}
+
+// Buffer: memória bruta, sem construir elementos
+template<class T>
+T* Queue<T>::allocateBuffer(size_t capacity) {
+    T* storage = static_cast<T*>(::operator new(capacity * sizeof(T)));
+    if (MemoryCounters::enabled) {
+        MemoryCounters::recordAllocation(ContainerKind::Queue, capacity * sizeof(T));
+    }
+    return storage;
+}
+
+template<class T>
+void Queue<T>::deallocateBuffer(T* storage, size_t capacity) {
+    if (storage == nullptr) {
+        return;
+    }
+    if (MemoryCounters::enabled) {
+        MemoryCounters::recordRelease(ContainerKind::Queue, capacity * sizeof(T));
+    }
+    ::operator delete(storage);
+}
+
+// Realocação: move os elementos para o início do buffer novo
+template<class T>
+void Queue<T>::reallocate(size_t newCapacity) {
+    T* newBuffer = newCapacity > 0 ? allocateBuffer(newCapacity) : nullptr;
+    size_t moved = 0;
+
+    try {
+        for (; moved < queueSize; ++moved) {
+            new (newBuffer + moved) T(std::move_if_noexcept(*slot(moved)));
+        }
+    } catch (...) {
+        for (size_t i = 0; i < moved; ++i) {
+            newBuffer[i].~T();
+        }
+        deallocateBuffer(newBuffer, newCapacity);
+        throw;
+    }
+
+    destroyAll();
+    deallocateBuffer(buffer, bufferCapacity);
+    buffer = newBuffer;
+    bufferCapacity = newCapacity;
+    head = 0;
+}
+
+// Destrói os elementos sem liberar o buffer
+template<class T>
+void Queue<T>::destroyAll() {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (size_t i = 0; i < queueSize; ++i) {
+            slot(i)->~T();
+        }
+    }
+}
+
+// Construct back
+template<class T>
+template<typename... Args>
+void Queue<T>::constructBack(Args&&... args) {
+    if (queueSize < bufferCapacity) {
+        new (slot(queueSize)) T(std::forward<Args>(args)...);
+        ++queueSize;
+        return;
+    }
+
+    size_t newCapacity = bufferCapacity == 0 ? minCapacity : 2 * bufferCapacity;
+    T* newBuffer = allocateBuffer(newCapacity);
+    size_t moved = 0;
+
+    try {
+        new (newBuffer + queueSize) T(std::forward<Args>(args)...);
+        try {
+            for (; moved < queueSize; ++moved) {
+                new (newBuffer + moved) T(std::move_if_noexcept(*slot(moved)));
+            }
+        } catch (...) {
+            newBuffer[queueSize].~T();
+            throw;
+        }
+    } catch (...) {
+        for (size_t i = 0; i < moved; ++i) {
+            newBuffer[i].~T();
+        }
+        deallocateBuffer(newBuffer, newCapacity);
+        throw;
+    }
+
+    destroyAll();
+    deallocateBuffer(buffer, bufferCapacity);
+    buffer = newBuffer;
+    bufferCapacity = newCapacity;
+    head = 0;
+    ++queueSize;
+}
+
+// Advance head
 template<class T>
-Queue<T>::Node::Node() : next(nullptr) {}
+void Queue<T>::advanceHead(size_t count) {
+    if (count > 0) {
+        head = (head + count) & (bufferCapacity - 1);
+        queueSize -= count;
+    }
+}
 
 template<class T>
-Queue<T>::Node::Node(const T& value) : data(value), next(nullptr) {}
+template<typename Container>
+auto Queue<T>::reserveIn(Container& target, size_t total, int) -> decltype(target.reserve(total), void()) {
+    target.reserve(total);
+}
 
+// Truncate
 template<class T>
-Queue<T>::Node::Node(T&& value) : data(std::move(value)), next(nullptr) {}
+void Queue<T>::truncate(size_t newSize) {
+    while (queueSize > newSize) {
+        --queueSize;
+        slot(queueSize)->~T();
+    }
+}
 
 // Construtor padrão
 template<class T>
-Queue<T>::Queue() : frontNode(nullptr), rearNode(nullptr), queueSize(0) {}
+Queue<T>::Queue() : buffer(nullptr), bufferCapacity(0), head(0), queueSize(0) {}
 
 // Construtor de cópia
 template<class T>
-Queue<T>::Queue(const Queue& other) : frontNode(nullptr), rearNode(nullptr), queueSize(0) {
-    *this = other;
+Queue<T>::Queue(const Queue& other) : Queue() {
+    reserve(other.queueSize);
+    for (size_t i = 0; i < other.queueSize; ++i) {
+        new (buffer + i) T(*other.slot(i));
+        ++queueSize;
+    }
 }
 
 // Construtor de movimento
 template<class T>
-Queue<T>::Queue(Queue&& other) noexcept 
-    : frontNode(other.frontNode), rearNode(other.rearNode), queueSize(other.queueSize) {
-    other.frontNode = nullptr;
-    other.rearNode = nullptr;
+Queue<T>::Queue(Queue&& other) noexcept
+    : buffer(other.buffer), bufferCapacity(other.bufferCapacity), head(other.head), queueSize(other.queueSize) {
+    other.buffer = nullptr;
+    other.bufferCapacity = 0;
+    other.head = 0;
     other.queueSize = 0;
 }
 
 // Construtor com lista de inicialização
 template<class T>
-Queue<T>::Queue(std::initializer_list<T> init) : frontNode(nullptr), rearNode(nullptr), queueSize(0) {
-    for (const auto& item : init) {
-        enqueue(item);
-    }
+Queue<T>::Queue(std::initializer_list<T> init) : Queue() {
+    enqueue(init.begin(), init.end());
+}
+
+// Construtor a partir de intervalo
+template<class T>
+template<typename InputIt, typename>
+Queue<T>::Queue(InputIt first, InputIt last) : Queue() {
+    enqueue(first, last);
 }
 
 // Destrutor
 template<class T>
 Queue<T>::~Queue() {
-    clear();
+    destroyAll();
+    deallocateBuffer(buffer, bufferCapacity);
 }
 
 // Operador de atribuição por cópia
 template<class T>
 Queue<T>& Queue<T>::operator=(const Queue& other) {
     if (this != &other) {
-        clear();
-        
-        Node* current = other.frontNode;
-        while (current != nullptr) {
-            enqueue(current->data);
-            current = current->next;
-        }
+        Queue temp(other);
+        swap(temp);
     }
     return *this;
 }
@@ -236,13 +433,8 @@ Queue<T>& Queue<T>::operator=(const Queue& other) {
 template<class T>
 Queue<T>& Queue<T>::operator=(Queue&& other) noexcept {
     if (this != &other) {
-        clear();
-        frontNode = other.frontNode;
-        rearNode = other.rearNode;
-        queueSize = other.queueSize;
-        other.frontNode = nullptr;
-        other.rearNode = nullptr;
-        other.queueSize = 0;
+        Queue temp(std::move(other));
+        swap(temp);
     }
     return *this;
 }
@@ -250,83 +442,126 @@ Queue<T>& Queue<T>::operator=(Queue&& other) noexcept {
 // Enqueue com cópia
 template<class T>
 void Queue<T>::enqueue(const T& value) {
-    Node* newNode = new Node(value);
-    
-    if (empty()) {
-        frontNode = rearNode = newNode;
-    } else {
-        rearNode->next = newNode;
-        rearNode = newNode;
-    }
-    ++queueSize;
+    constructBack(value);
 }
 
 // Enqueue com movimento
 template<class T>
 void Queue<T>::enqueue(T&& value) {
-    Node* newNode = new Node(std::move(value));
-    
-    if (empty()) {
-        frontNode = rearNode = newNode;
-    } else {
-        rearNode->next = newNode;
-        rearNode = newNode;
-    }
-    ++queueSize;
+    constructBack(std::move(value));
 }
 
 // Emplace
 template<class T>
 template<typename... Args>
 void Queue<T>::emplace(Args&&... args) {
-    Node* newNode = new Node();
-    newNode->data = T(std::forward<Args>(args)...);
-    
-    if (empty()) {
-        frontNode = rearNode = newNode;
+    constructBack(std::forward<Args>(args)...);
+}
+
+// Enqueue em lote
+template<class T>
+template<typename InputIt, typename>
+void Queue<T>::enqueue(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+        reserve(queueSize + static_cast<size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        constructBack(*first);
+    }
+}
+
+template<class T>
+template<typename Range>
+void Queue<T>::enqueueRange(Range&& range) {
+    using std::begin;
+    using std::end;
+    if constexpr (std::is_rvalue_reference<Range&&>::value) {
+        enqueue(std::make_move_iterator(begin(range)), std::make_move_iterator(end(range)));
     } else {
-        rearNode->next = newNode;
-        rearNode = newNode;
+        enqueue(begin(range), end(range));
     }
-    ++queueSize;
 }
 
-// Dequeue
+// Assign: monta a fila nova antes de trocar (a fila fica intacta se uma cópia lançar)
+template<class T>
+template<typename InputIt, typename>
+void Queue<T>::assign(InputIt first, InputIt last) {
+    Queue temp(first, last);
+    swap(temp);
+}
+
+// Dequeue: só avança head; o buffer é reutilizado
 template<class T>
 void Queue<T>::dequeue() {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    
-    Node* temp = frontNode;
-    frontNode = frontNode->next;
-    
-    if (frontNode == nullptr) {
-        rearNode = nullptr;
-    }
-    
-    delete temp;
+
+    buffer[head].~T();
+    head = (head + 1) & (bufferCapacity - 1);
     --queueSize;
 }
 
-// Dequeue and return
+// Dequeue and return: move o elemento para fora antes de destruí-lo
 template<class T>
 T Queue<T>::dequeueAndReturn() {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    T value = frontNode->data;
+    T value = std::move(buffer[head]);
     dequeue();
     return value;
 }
 
+// Try dequeue
+template<class T>
+bool Queue<T>::tryDequeue(T& out) {
+    if (empty()) {
+        return false;
+    }
+    out = std::move(buffer[head]);
+    dequeue();
+    return true;
+}
+
+// Dequeue em lote: se uma atribuição lançar, os elementos já movidos
+// saem da fila e o atual permanece na frente
+template<class T>
+template<typename OutputIt>
+size_t Queue<T>::dequeueBulk(OutputIt out, size_t maxCount) {
+    size_t count = std::min(maxCount, queueSize);
+    size_t moved = 0;
+    try {
+        for (; moved < count; ++moved) {
+            T* item = slot(moved);
+            *out = std::move(*item);
+            ++out;
+            item->~T();
+        }
+    } catch (...) {
+        advanceHead(moved);
+        throw;
+    }
+    advanceHead(count);
+    return count;
+}
+
+// Drain to
+template<class T>
+template<typename Container>
+size_t Queue<T>::drainTo(Container& target) {
+    reserveIn(target, target.size() + queueSize, 0);
+    return dequeueBulk(std::back_inserter(target), queueSize);
+}
+
 // Front (referência)
 template<class T>
 T& Queue<T>::front() {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    return frontNode->data;
+    return buffer[head];
 }
 
 // Front (const)
@@ -335,7 +570,7 @@ const T& Queue<T>::front() const {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    return frontNode->data;
+    return buffer[head];
 }
 
 // Rear (referência)
@@ -344,7 +579,7 @@ T& Queue<T>::rear() {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    return rearNode->data;
+    return *slot(queueSize - 1);
 }
 
 // Rear (const)
@@ -353,13 +588,13 @@ const T& Queue<T>::rear() const {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    return rearNode->data;
+    return *slot(queueSize - 1);
 }
 
 // Empty
 template<class T>
 bool Queue<T>::empty() const {
-    return frontNode == nullptr;
+    return queueSize == 0;
 }
 
 // Size
@@ -368,31 +603,42 @@ size_t Queue<T>::size() const {
     return queueSize;
 }
 
-// Contains
+// Capacity
 template<class T>
-bool Queue<T>::contains(const T& value) const {
-    Node* current = frontNode;
-    while (current != nullptr) {
-        if (current->data == value) {
-            return true;
+size_t Queue<T>::capacity() const {
+    return bufferCapacity;
+}
+
+// Memory usage: o buffer inteiro conta como "nós"; posições livres ficam fora de payloadBytes
+template<class T>
+MemoryUsage Queue<T>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    usage.nodeBytes = bufferCapacity * sizeof(T);
+    usage.payloadBytes = queueSize * sizeof(T);
+    if (bufferCapacity > 0) {
+        usage.slackBytes = allocationSlack(bufferCapacity * sizeof(T));
+    }
+    if (DeepSize<T>::indirect) {
+        for (size_t i = 0; i < queueSize; ++i) {
+            usage.deepBytes += DeepSize<T>::of(*slot(i));
         }
-        current = current->next;
     }
-    return false;
+    return usage;
 }
 
-// Count
+// Contains
+template<class T>
+bool Queue<T>::contains(const T& value) const {
+    return findFirst(value) != -1;
+}
+
+// Count: os elementos ocupam no máximo dois trechos contíguos
 template<class T>
 size_t Queue<T>::count(const T& value) const {
-    size_t counter = 0;
-    Node* current = frontNode;
-    while (current != nullptr) {
-        if (current->data == value) {
-            ++counter;
-        }
-        current = current->next;
-    }
-    return counter;
+    size_t firstLength = std::min(queueSize, bufferCapacity - head);
+    return static_cast<size_t>(std::count(buffer + head, buffer + head + firstLength, value) +
+                               std::count(buffer, buffer + (queueSize - firstLength), value));
 }
 
 // At (referência)
@@ -401,11 +647,7 @@ T& Queue<T>::at(size_t index) {
     if (index >= queueSize) {
         throw std::out_of_range("Index out of range");
     }
-    Node* current = frontNode;
-    for (size_t i = 0; i < index; ++i) {
-        current = current->next;
-    }
-    return current->data;
+    return *slot(index);
 }
 
 // At (const)
@@ -414,119 +656,137 @@ const T& Queue<T>::at(size_t index) const {
     if (index >= queueSize) {
         throw std::out_of_range("Index out of range");
     }
-    Node* current = frontNode;
-    for (size_t i = 0; i < index; ++i) {
-        current = current->next;
+    return *slot(index);
+}
+
+// Reserve: arredonda para potência de dois
+template<class T>
+void Queue<T>::reserve(size_t minCount) {
+    if (minCount <= bufferCapacity) {
+        return;
+    }
+    size_t newCapacity = bufferCapacity == 0 ? minCapacity : bufferCapacity;
+    while (newCapacity < minCount) {
+        newCapacity *= 2;
+    }
+    reallocate(newCapacity);
+}
+
+// Shrink to fit
+template<class T>
+void Queue<T>::shrinkToFit() {
+    if (queueSize == 0) {
+        deallocateBuffer(buffer, bufferCapacity);
+        buffer = nullptr;
+        bufferCapacity = 0;
+        head = 0;
+        return;
+    }
+
+    size_t newCapacity = minCapacity;
+    while (newCapacity < queueSize) {
+        newCapacity *= 2;
+    }
+    if (newCapacity < bufferCapacity) {
+        reallocate(newCapacity);
     }
-    return current->data;
 }
 
 // Clear
 template<class T>
 void Queue<T>::clear() {
-    while (!empty()) {
-        dequeue();
-    }
+    destroyAll();
+    head = 0;
+    queueSize = 0;
 }
 
 // Swap
 template<class T>
 void Queue<T>::swap(Queue& other) noexcept {
-    std::swap(frontNode, other.frontNode);
-    std::swap(rearNode, other.rearNode);
+    std::swap(buffer, other.buffer);
+    std::swap(bufferCapacity, other.bufferCapacity);
+    std::swap(head, other.head);
     std::swap(queueSize, other.queueSize);
 }
 
-// Remove all
+// Remove all: compacta os mantidos para a frente (estável) e descarta o final
 template<class T>
 size_t Queue<T>::removeAll(const T& value) {
-    size_t removed = 0;
-    Queue<T> temp;
-    
-    while (!empty()) {
-        if (front() != value) {
-            temp.enqueue(dequeueAndReturn());
-        } else {
-            dequeue();
-            ++removed;
+    size_t kept = 0;
+    for (size_t i = 0; i < queueSize; ++i) {
+        T* current = slot(i);
+        if (*current != value) {
+            if (kept != i) {
+                *slot(kept) = std::move(*current);
+            }
+            ++kept;
         }
     }
-    
-    while (!temp.empty()) {
-        enqueue(temp.dequeueAndReturn());
-    }
-    
+
+    size_t removed = queueSize - kept;
+    truncate(kept);
     return removed;
 }
 
-// Remove first
+// Remove first: desloca os seguintes uma posição
 template<class T>
 bool Queue<T>::removeFirst(const T& value) {
-    Queue<T> temp;
-    bool found = false;
-    
-    while (!empty() && !found) {
-        if (front() == value) {
-            dequeue();
-            found = true;
-        } else {
-            temp.enqueue(dequeueAndReturn());
-        }
+    int index = findFirst(value);
+    if (index == -1) {
+        return false;
     }
-    
-    while (!temp.empty()) {
-        enqueue(temp.dequeueAndReturn());
+
+    for (size_t i = static_cast<size_t>(index); i + 1 < queueSize; ++i) {
+        *slot(i) = std::move(*slot(i + 1));
     }
-    
-    return found;
+    truncate(queueSize - 1);
+    return true;
 }
 
-// Duplicate
+// Duplicate: nova cópia da frente antes de head
 template<class T>
 void Queue<T>::duplicate() {
     if (empty()) {
         throw std::underflow_error("Queue is empty");
     }
-    T value = front();
-    
-    // Precisamos inserir na frente, então removemos tudo, inserimos duplicata e reinsere tudo
-    Queue<T> temp;
-    while (!empty()) {
-        temp.enqueue(dequeueAndReturn());
-    }
-    
-    enqueue(value);
-    while (!temp.empty()) {
-        enqueue(temp.dequeueAndReturn());
-    }
+
+    reserve(queueSize + 1);
+    size_t newHead = (head - 1) & (bufferCapacity - 1);
+    new (buffer + newHead) T(buffer[head]);
+    head = newHead;
+    ++queueSize;
 }
 
-// Reverse
+// Reverse: troca in-place das pontas para o centro
 template<class T>
 void Queue<T>::reverse() {
     if (queueSize <= 1) return;
-    
-    std::vector<T> temp;
-    while (!empty()) {
-        temp.push_back(dequeueAndReturn());
+
+    if (head + queueSize <= bufferCapacity) {
+        std::reverse(buffer + head, buffer + head + queueSize);
+        return;
     }
-    
-    for (auto it = temp.rbegin(); it != temp.rend(); ++it) {
-        enqueue(*it);
+
+    using std::swap;
+    for (size_t i = 0, j = queueSize - 1; i < j; ++i, --j) {
+        swap(*slot(i), *slot(j));
     }
 }
 
 // Find first
 template<class T>
 int Queue<T>::findFirst(const T& value) const {
-    Node* current = frontNode;
-    int index = 0;
-    while (current != nullptr) {
-        if (current->data == value) {
-            return index;
-        }
-        current = current->next;
-        ++index;
+    size_t firstLength = std::min(queueSize, bufferCapacity - head);
+    const T* found = std::find(buffer + head, buffer + head + firstLength, value);
+    if (found != buffer + head + firstLength) {
+        return static_cast<int>(found - (buffer + head));
+    }
+
+    const T* secondBegin = buffer;
+    const T* secondEnd = buffer + (queueSize - firstLength);
+    found = std::find(secondBegin, secondEnd, value);
+    if (found != secondEnd) {
+        return static_cast<int>(firstLength + (found - secondBegin));
     }
     return -1;
 }
@@ -534,48 +794,37 @@ int Queue<T>::findFirst(const T& value) const {
 // Find last
 template<class T>
 int Queue<T>::findLast(const T& value) const {
-    Node* current = frontNode;
-    int index = 0;
-    int lastFound = -1;
-    while (current != nullptr) {
-        if (current->data == value) {
-            lastFound = index;
+    for (size_t i = queueSize; i > 0; --i) {
+        if (*slot(i - 1) == value) {
+            return static_cast<int>(i - 1);
         }
-        current = current->next;
-        ++index;
     }
-    return lastFound;
+    return -1;
 }
 
 // For each (não const)
 template<class T>
 void Queue<T>::forEach(std::function<void(T&)> func) {
-    Node* current = frontNode;
-    while (current != nullptr) {
-        func(current->data);
-        current = current->next;
+    for (size_t i = 0; i < queueSize; ++i) {
+        func(*slot(i));
     }
 }
 
 // For each (const)
 template<class T>
 void Queue<T>::forEach(std::function<void(const T&)> func) const {
-    Node* current = frontNode;
-    while (current != nullptr) {
-        func(current->data);
-        current = current->next;
+    for (size_t i = 0; i < queueSize; ++i) {
+        func(*slot(i));
     }
 }
 
 // All of
 template<class T>
 bool Queue<T>::allOf(std::function<bool(const T&)> predicate) const {
-    Node* current = frontNode;
-    while (current != nullptr) {
-        if (!predicate(current->data)) {
+    for (size_t i = 0; i < queueSize; ++i) {
+        if (!predicate(*slot(i))) {
             return false;
         }
-        current = current->next;
     }
     return true;
 }
@@ -583,26 +832,22 @@ bool Queue<T>::allOf(std::function<bool(const T&)> predicate) const {
 // Any of
 template<class T>
 bool Queue<T>::anyOf(std::function<bool(const T&)> predicate) const {
-    Node* current = frontNode;
-    while (current != nullptr) {
-        if (predicate(current->data)) {
+    for (size_t i = 0; i < queueSize; ++i) {
+        if (predicate(*slot(i))) {
             return true;
         }
-        current = current->next;
     }
     return false;
 }
 
-// To vector
+// To vector: copia os dois trechos contíguos
 template<class T>
 std::vector<T> Queue<T>::toVector() const {
     std::vector<T> result;
     result.reserve(queueSize);
-    Node* current = frontNode;
-    while (current != nullptr) {
-        result.push_back(current->data);
-        current = current->next;
-    }
+    size_t firstLength = std::min(queueSize, bufferCapacity - head);
+    result.insert(result.end(), buffer + head, buffer + head + firstLength);
+    result.insert(result.end(), buffer, buffer + (queueSize - firstLength));
     return result;
 }
 
@@ -620,19 +865,13 @@ bool Queue<T>::operator==(const Queue& other) const {
     if (queueSize != other.queueSize) {
         return false;
     }
-    
-    Node* current1 = frontNode;
-    Node* current2 = other.frontNode;
-    
-    while (current1 != nullptr && current2 != nullptr) {
-        if (current1->data != current2->data) {
+
+    for (size_t i = 0; i < queueSize; ++i) {
+        if (*slot(i) != *other.slot(i)) {
             return false;
         }
-        current1 = current1->next;
-        current2 = current2->next;
     }
-    
-    return current1 == nullptr && current2 == nullptr;
+    return true;
 }
 
 // Operator !=
@@ -641,67 +880,92 @@ bool Queue<T>::operator!=(const Queue& other) const {
     return !(*this == other);
 }
 
-// Print
+// Print (bufferizado; termina com '\n' sem forçar flush)
 template<class T>
 void Queue<T>::print() const {
-    std::cout << "Queue [size=" << queueSize << "]: ";
+    OutputBuffer out(std::cout);
+    out.append("Queue [size=");
+    out.appendValue(queueSize);
+    out.append(", capacity=");
+    out.appendValue(bufferCapacity);
+    out.append("]: ");
     if (empty()) {
-        std::cout << "(empty)";
+        out.append("(empty)");
     } else {
-        std::cout << "FRONT -> ";
-        Node* current = frontNode;
-        while (current != nullptr) {
-            std::cout << current->data;
-            if (current->next != nullptr) {
-                std::cout << " -> ";
+        out.append("FRONT -> ");
+        for (size_t i = 0; i < queueSize; ++i) {
+            if (i > 0) {
+                out.append(" -> ", 4);
             }
-            current = current->next;
+            out.appendValue(*slot(i));
         }
-        std::cout << " <- REAR";
+        out.append(" <- REAR");
     }
-    std::cout << std::endl;
+    out.append('\n');
+    out.flush();
 }
 
-// Check integrity
+// Escreve "[a, b, c]" ou, em modo preview, "[a, b, ... (n omitted), y, z]"
 template<class T>
-bool Queue<T>::checkIntegrity() const {
-    if (queueSize == 0) {
-        return frontNode == nullptr && rearNode == nullptr;
+void Queue<T>::writeElements(OutputBuffer& out, size_t previewCount) const {
+    bool truncated = previewCount > 0 && 2 * previewCount < queueSize;
+    size_t leading = truncated ? previewCount : queueSize;
+
+    out.append('[');
+    for (size_t i = 0; i < leading; ++i) {
+        if (i > 0) {
+            out.append(", ", 2);
+        }
+        out.appendValue(*slot(i));
     }
-    
-    if (queueSize == 1) {
-        return frontNode == rearNode && frontNode != nullptr;
+
+    if (truncated) {
+        out.append(", ... (");
+        out.appendValue(queueSize - 2 * previewCount);
+        out.append(" omitted)");
+        for (size_t i = queueSize - previewCount; i < queueSize; ++i) {
+            out.append(", ", 2);
+            out.appendValue(*slot(i));
+        }
     }
-    
-    size_t count = 0;
-    Node* current = frontNode;
-    Node* last = nullptr;
-    
-    while (current != nullptr) {
-        ++count;
-        last = current;
-        current = current->next;
+    out.append(']');
+}
+
+// Write to
+template<class T>
+void Queue<T>::writeTo(std::ostream& os, size_t previewCount) const {
+    OutputBuffer out(os);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
+}
+
+template<class T>
+void Queue<T>::writeTo(int fd, size_t previewCount) const {
+    OutputBuffer out(fd);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
+}
+
+// Check integrity
+template<class T>
+bool Queue<T>::checkIntegrity() const {
+    if (bufferCapacity == 0) {
+        return buffer == nullptr && head == 0 && queueSize == 0;
     }
-    
-    return count == queueSize && last == rearNode;
+
+    bool powerOfTwo = (bufferCapacity & (bufferCapacity - 1)) == 0;
+    return buffer != nullptr && powerOfTwo && head < bufferCapacity && queueSize <= bufferCapacity;
 }
 
 // Operador de saída
 template<class T>
 std::ostream& operator<<(std::ostream& os, const Queue<T>& queue) {
-    os << "[";
-    typename Queue<T>::Node* current = queue.frontNode;
-    bool first = true;
-    while (current != nullptr) {
-        if (!first) {
-            os << ", ";
-        }
-        os << current->data;
-        first = false;
-        current = current->next;
-    }
-    os << "]";
+    OutputBuffer out(os);
+    queue.writeElements(out, 0);
+    out.flush();
     return os;
 }
 
-#endif // QUEUE_H
\ No newline at end of file
+#endif // QUEUE_H
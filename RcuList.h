@@ -0,0 +1,353 @@
+#ifndef RCULIST_H
+#define RCULIST_H
+
+#include "List.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Lista read-copy-update para cenários com muitas leituras.
+// Leitores obtêm um Snapshot imutável e o percorrem sem locks nem atomics;
+// o único custo atômico é ao abrir o snapshot (anúncio de época).
+// Escritores copiam a versão atual, aplicam a alteração e publicam a nova
+// versão atomicamente. Versões antigas são liberadas por épocas, quando
+// nenhum leitor ativo pode mais observá-las.
+template<class T>
+class RcuList {
+private:
+    static constexpr uint64_t idleEpoch = 0;
+
+    // Slot de época de um leitor (em linha de cache própria)
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch;
+        std::atomic<bool> inUse;
+
+        ReaderSlot() : epoch(idleEpoch), inUse(false) {}
+    };
+
+    // Versão aposentada aguardando liberação
+    struct Retired {
+        const List<T>* version;
+        uint64_t epoch;
+    };
+
+    std::atomic<const List<T>*> current;
+    std::atomic<uint64_t> globalEpoch;
+    std::unique_ptr<ReaderSlot[]> slots;
+    size_t slotCount;
+
+    std::mutex writerMutex;             // Serializa escritores
+    std::vector<Retired> retired;       // Protegido por writerMutex
+
+    // Publica nova versão e aposenta a anterior (writerMutex já adquirido);
+    // assume a posse de version, inclusive se lançar
+    void publishLocked(const List<T>* version);
+
+    // Libera versões que nenhum leitor pode observar (writerMutex já adquirido)
+    size_t reclaimLocked();
+
+    // Menor época anunciada por leitores ativos
+    uint64_t minActiveEpoch() const;
+
+public:
+    class Reader;
+
+    // ==================== SNAPSHOT ====================
+    // Visão imutável de uma versão; válida enquanto o objeto existir
+    class Snapshot {
+    private:
+        Reader* reader;
+        const List<T>* version;
+        friend class Reader;
+
+        Snapshot(Reader* owner, const List<T>* list) : reader(owner), version(list) {}
+
+    public:
+        using ConstIterator = typename List<T>::ConstIterator;
+
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        Snapshot(Snapshot&& other) noexcept : reader(other.reader), version(other.version) {
+            other.reader = nullptr;
+        }
+        Snapshot& operator=(Snapshot&&) = delete;
+
+        ~Snapshot() {
+            if (reader != nullptr) {
+                reader->leave();
+            }
+        }
+
+        ConstIterator begin() const { return version->begin(); }
+        ConstIterator end() const { return version->end(); }
+
+        const List<T>& list() const { return *version; }
+        const List<T>* operator->() const { return version; }
+
+        size_t size() const { return version->size(); }
+        bool empty() const { return version->empty(); }
+        bool contains(const T& value) const { return version->contains(value); }
+        void forEach(std::function<void(const T&)> func) const { version->forEach(func); }
+        std::vector<T> toVector() const { return version->toVector(); }
+    };
+
+    // ==================== LEITOR ====================
+    // Registro de um leitor (um por thread); ocupa um slot de época
+    class Reader {
+    private:
+        RcuList* owner;
+        ReaderSlot* slot;
+        size_t depth; // Snapshots aninhados reutilizam a mesma época
+        friend class Snapshot;
+
+        void leave();
+
+    public:
+        explicit Reader(RcuList& list);
+        ~Reader();
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Abre um snapshot da versão publicada mais recente
+        Snapshot snapshot();
+    };
+
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor com número máximo de leitores simultâneos
+    explicit RcuList(size_t maxReaders = 64);
+
+    // Construtor a partir de uma lista inicial
+    explicit RcuList(List<T> initial, size_t maxReaders = 64);
+
+    // Destrutor (não pode haver leitores ativos)
+    ~RcuList();
+
+    RcuList(const RcuList&) = delete;
+    RcuList& operator=(const RcuList&) = delete;
+
+    // ==================== MÉTODOS DE ESCRITA ====================
+
+    // Copia a versão atual, aplica a alteração e publica o resultado
+    void update(std::function<void(List<T>&)> mutator);
+
+    // Substitui o conteúdo inteiro
+    void publish(List<T> list);
+
+    // Atalhos de escrita
+    void pushBack(const T& value);
+    void pushFront(const T& value);
+    size_t removeAll(const T& value);
+    void clear();
+
+    // ==================== RECLAMAÇÃO ====================
+
+    // Libera versões antigas que já não são observáveis; retorna quantas
+    size_t reclaim();
+
+    // Aguarda até que todas as versões antigas possam ser liberadas
+    void synchronize();
+
+    // Número de versões aguardando liberação
+    size_t pendingReclamation();
+
+    // ==================== CONSULTA ====================
+
+    // Cópia da versão atual (sem registrar leitor)
+    List<T> copy();
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Reader
+template<class T>
+RcuList<T>::Reader::Reader(RcuList& list) : owner(&list), slot(nullptr), depth(0) {
+    for (size_t i = 0; i < owner->slotCount; ++i) {
+        bool expected = false;
+        if (owner->slots[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            slot = &owner->slots[i];
+            return;
+        }
+    }
+    throw std::length_error("Too many RcuList readers");
+}
+
+template<class T>
+RcuList<T>::Reader::~Reader() {
+    slot->epoch.store(idleEpoch, std::memory_order_release);
+    slot->inUse.store(false, std::memory_order_release);
+}
+
+// Snapshot: anuncia a época antes de ler o ponteiro da versão
+template<class T>
+typename RcuList<T>::Snapshot RcuList<T>::Reader::snapshot() {
+    if (depth++ == 0) {
+        slot->epoch.store(owner->globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    }
+    return Snapshot(this, owner->current.load(std::memory_order_seq_cst));
+}
+
+template<class T>
+void RcuList<T>::Reader::leave() {
+    if (--depth == 0) {
+        slot->epoch.store(idleEpoch, std::memory_order_release);
+    }
+}
+
+// Construtores
+template<class T>
+RcuList<T>::RcuList(size_t maxReaders)
+    : current(new List<T>()), globalEpoch(1),
+      slots(new ReaderSlot[maxReaders]), slotCount(maxReaders) {}
+
+template<class T>
+RcuList<T>::RcuList(List<T> initial, size_t maxReaders)
+    : current(new List<T>(std::move(initial))), globalEpoch(1),
+      slots(new ReaderSlot[maxReaders]), slotCount(maxReaders) {}
+
+// Destrutor
+template<class T>
+RcuList<T>::~RcuList() {
+    for (const auto& entry : retired) {
+        delete entry.version;
+    }
+    delete current.load(std::memory_order_relaxed);
+}
+
+// Publicação: troca o ponteiro, aposenta a versão antiga e avança a época.
+// O espaço na lista de aposentadas é reservado antes da troca: depois dela
+// uma falha de alocação vazaria a versão antiga ainda visível a leitores.
+// Se a reserva falhar, nada foi publicado e version é liberada.
+template<class T>
+void RcuList<T>::publishLocked(const List<T>* version) {
+    try {
+        if (retired.size() == retired.capacity()) {
+            // reserve(size() + 1) cresceria um slot por vez
+            retired.reserve(retired.empty() ? 8 : 2 * retired.capacity());
+        }
+    } catch (...) {
+        delete version;
+        throw;
+    }
+    const List<T>* old = current.exchange(version, std::memory_order_seq_cst);
+    uint64_t epoch = globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+    retired.push_back({old, epoch});
+    reclaimLocked();
+}
+
+template<class T>
+uint64_t RcuList<T>::minActiveEpoch() const {
+    uint64_t minEpoch = UINT64_MAX;
+    for (size_t i = 0; i < slotCount; ++i) {
+        uint64_t epoch = slots[i].epoch.load(std::memory_order_seq_cst);
+        if (epoch != idleEpoch && epoch < minEpoch) {
+            minEpoch = epoch;
+        }
+    }
+    return minEpoch;
+}
+
+// Uma versão aposentada na época e só é visível a leitores com época <= e
+template<class T>
+size_t RcuList<T>::reclaimLocked() {
+    if (retired.empty()) {
+        return 0;
+    }
+
+    uint64_t minEpoch = minActiveEpoch();
+    size_t freed = 0;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < retired.size(); ++i) {
+        if (retired[i].epoch < minEpoch) {
+            delete retired[i].version;
+            ++freed;
+        } else {
+            retired[kept++] = retired[i];
+        }
+    }
+    retired.resize(kept);
+    return freed;
+}
+
+// Update
+template<class T>
+void RcuList<T>::update(std::function<void(List<T>&)> mutator) {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    List<T>* next = new List<T>(*current.load(std::memory_order_relaxed));
+    try {
+        mutator(*next);
+    } catch (...) {
+        delete next;
+        throw;
+    }
+    publishLocked(next);
+}
+
+// Publish
+template<class T>
+void RcuList<T>::publish(List<T> list) {
+    List<T>* next = new List<T>(std::move(list));
+    std::lock_guard<std::mutex> lock(writerMutex);
+    publishLocked(next);
+}
+
+// Atalhos de escrita
+template<class T>
+void RcuList<T>::pushBack(const T& value) {
+    update([&value](List<T>& list) { list.pushBack(value); });
+}
+
+template<class T>
+void RcuList<T>::pushFront(const T& value) {
+    update([&value](List<T>& list) { list.pushFront(value); });
+}
+
+template<class T>
+size_t RcuList<T>::removeAll(const T& value) {
+    size_t removed = 0;
+    update([&value, &removed](List<T>& list) { removed = list.removeAll(value); });
+    return removed;
+}
+
+template<class T>
+void RcuList<T>::clear() {
+    publish(List<T>());
+}
+
+// Reclamação
+template<class T>
+size_t RcuList<T>::reclaim() {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    return reclaimLocked();
+}
+
+template<class T>
+void RcuList<T>::synchronize() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(writerMutex);
+            reclaimLocked();
+            if (retired.empty()) {
+                return;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+template<class T>
+size_t RcuList<T>::pendingReclamation() {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    return retired.size();
+}
+
+// Copy
+template<class T>
+List<T> RcuList<T>::copy() {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    return List<T>(*current.load(std::memory_order_relaxed));
+}
+
+#endif // RCULIST_H
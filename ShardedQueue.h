@@ -0,0 +1,366 @@
+#ifndef SHARDEDQUEUE_H
+#define SHARDEDQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Queue.h"
+
+enum class ShardOrdering {
+    Relaxed,    // FIFO só dentro de cada shard (escala com o número de threads)
+    StrictFifo  // FIFO global por tickets (dois contadores globais disputados)
+};
+
+// Fila concorrente particionada: um Queue<T> com mutex próprio por shard,
+// cada shard em sua linha de cache. Cada thread recebe um shard "local"
+// (atribuído em rodízio no primeiro uso).
+//
+// Relaxed: enqueue vai para o shard local; dequeue tenta o local e depois
+// rouba dos outros a partir de um ponto aleatório, pulando os que o
+// contador relaxed indica vazios. Threads diferentes quase nunca disputam
+// o mesmo mutex, mas a ordem entre elementos de shards diferentes não é
+// garantida.
+//
+// StrictFifo: enqueue pega um ticket global t e grava no shard t % shards
+// (na vez do ticket: espera o enqueue do ticket t - shards terminar);
+// dequeue retira do shard d % shards o elemento com o próximo ticket de
+// saída d. A ordem de saída é exatamente a ordem dos tickets de entrada.
+// tryDequeue não espera: se o enqueue do ticket d ainda não gravou, retorna
+// false. Se o enqueue lançar depois de tomar o ticket, o ticket fica sem
+// elemento e o dequeue o pula.
+template<class T>
+class ShardedQueue {
+private:
+    static constexpr size_t cacheLine = 64;
+
+    struct Entry {
+        T value;
+        size_t ticket;  // Só usado em StrictFifo
+    };
+
+    struct alignas(cacheLine) Shard {
+        std::mutex mutex;
+        Queue<Entry> items;
+        std::atomic<size_t> count{0};  // Espelho relaxed de items.size()
+        size_t nextTicket = 0;         // StrictFifo: próximo ticket a gravar aqui
+                                       // (tickets menores já gravados ou pulados)
+    };
+
+    struct alignas(cacheLine) Ticket {
+        std::atomic<size_t> value{0};
+    };
+
+    std::vector<Shard> shards;
+    ShardOrdering mode;
+    Ticket enqueueTicket;
+    Ticket dequeueTicket;
+
+    // Índice estável da thread atual (rodízio global) e gerador por thread
+    static size_t threadSlot();
+    static uint64_t nextRandom();
+
+    size_t localShard() const;
+
+    template<typename... Args>
+    void enqueueRelaxed(Args&&... args);
+
+    template<typename... Args>
+    void enqueueStrict(Args&&... args);
+
+    bool dequeueFrom(Shard& shard, T& out);
+
+    // deliver(T&&) recebe o elemento retirado; se lançar, o elemento fica
+    template<typename Deliver>
+    bool dequeueStrict(Deliver deliver);
+
+public:
+    // ==================== CONSTRUTORES ====================
+    // Construtor com número de shards (0 = hardware_concurrency) e modo de ordem
+    explicit ShardedQueue(size_t shardCount = 0, ShardOrdering ordering = ShardOrdering::Relaxed);
+
+    ShardedQueue(const ShardedQueue&) = delete;
+    ShardedQueue& operator=(const ShardedQueue&) = delete;
+
+    // ==================== PRODUTORES ====================
+
+    void enqueue(const T& value);
+    void enqueue(T&& value);
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // ==================== CONSUMIDORES ====================
+
+    // Tenta remover um elemento para out; retorna false se vazia (em
+    // StrictFifo, também se o próximo elemento ainda está sendo gravado)
+    bool tryDequeue(T& out);
+
+    // Remove até maxCount elementos para out; em Relaxed, um lote por
+    // shard visitado (um lock por lote); retorna quantos
+    template<typename OutputIt>
+    size_t tryDequeueBulk(OutputIt out, size_t maxCount);
+
+    // ==================== CONSULTA ====================
+
+    // Soma relaxed dos contadores dos shards (aproximada sob concorrência)
+    size_t sizeApprox() const;
+    bool emptyApprox() const;
+
+    size_t shardCount() const;
+    ShardOrdering ordering() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtor
+template<class T>
+ShardedQueue<T>::ShardedQueue(size_t shardCount, ShardOrdering ordering) : mode(ordering) {
+    if (shardCount == 0) {
+        shardCount = std::thread::hardware_concurrency();
+    }
+    if (shardCount == 0) {
+        shardCount = 1;
+    }
+    std::vector<Shard> created(shardCount);
+    shards.swap(created);
+    for (size_t i = 0; i < shardCount; ++i) {
+        shards[i].nextTicket = i;
+    }
+}
+
+// Threads e aleatoriedade
+template<class T>
+size_t ShardedQueue<T>::threadSlot() {
+    static std::atomic<size_t> nextSlot{0};
+    static thread_local size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+// xorshift64 por thread: barato e sem estado compartilhado
+template<class T>
+uint64_t ShardedQueue<T>::nextRandom() {
+    static thread_local uint64_t state = 0x9E3779B97F4A7C15ull * (threadSlot() + 1);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template<class T>
+size_t ShardedQueue<T>::localShard() const {
+    return threadSlot() % shards.size();
+}
+
+// Enqueue relaxed: só o shard local
+template<class T>
+template<typename... Args>
+void ShardedQueue<T>::enqueueRelaxed(Args&&... args) {
+    Shard& shard = shards[localShard()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.items.enqueue(Entry{T(std::forward<Args>(args)...), 0});
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Enqueue estrito: o valor é construído antes de tomar o ticket; a
+// gravação espera a vez do ticket no shard (o anterior já está gravando).
+// nextTicket avança antes de gravar: se a gravação lançar, o ticket
+// consta como pulado e nem o próximo enqueue nem o dequeue ficam esperando
+template<class T>
+template<typename... Args>
+void ShardedQueue<T>::enqueueStrict(Args&&... args) {
+    T value(std::forward<Args>(args)...);
+    size_t ticket = enqueueTicket.value.fetch_add(1, std::memory_order_acq_rel);
+    Shard& shard = shards[ticket % shards.size()];
+
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.nextTicket == ticket) {
+                shard.nextTicket += shards.size();
+                shard.items.enqueue(Entry{std::move(value), ticket});
+                shard.count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+template<class T>
+void ShardedQueue<T>::enqueue(const T& value) {
+    emplace(value);
+}
+
+template<class T>
+void ShardedQueue<T>::enqueue(T&& value) {
+    emplace(std::move(value));
+}
+
+template<class T>
+template<typename... Args>
+void ShardedQueue<T>::emplace(Args&&... args) {
+    if (mode == ShardOrdering::StrictFifo) {
+        enqueueStrict(std::forward<Args>(args)...);
+    } else {
+        enqueueRelaxed(std::forward<Args>(args)...);
+    }
+}
+
+// Dequeue de um shard; o contador relaxed evita travar shards vazios
+template<class T>
+bool ShardedQueue<T>::dequeueFrom(Shard& shard, T& out) {
+    if (shard.count.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.items.empty()) {
+        return false;
+    }
+    out = std::move(shard.items.front().value);
+    shard.items.dequeue();
+    shard.count.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Dequeue estrito: o ticket de saída d só avança com o mutex do shard
+// d % shards travado, então quem o trava e ainda vê d é o único dono de d.
+// O elemento de d está na frente do shard (os tickets menores já saíram);
+// se não está e nextTicket já passou de d, o enqueue de d lançou e d é
+// pulado; senão o enqueue de d ainda não gravou e não há o que retirar
+template<class T>
+template<typename Deliver>
+bool ShardedQueue<T>::dequeueStrict(Deliver deliver) {
+    while (true) {
+        size_t ticket = dequeueTicket.value.load(std::memory_order_acquire);
+        if (ticket >= enqueueTicket.value.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        Shard& shard = shards[ticket % shards.size()];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (dequeueTicket.value.load(std::memory_order_relaxed) != ticket) {
+            continue; // Outro consumidor levou d
+        }
+        if (!shard.items.empty() && shard.items.front().ticket == ticket) {
+            deliver(std::move(shard.items.front().value));
+            shard.items.dequeue();
+            shard.count.fetch_sub(1, std::memory_order_relaxed);
+            dequeueTicket.value.store(ticket + 1, std::memory_order_release);
+            return true;
+        }
+        if (shard.nextTicket <= ticket) {
+            return false;
+        }
+        dequeueTicket.value.store(ticket + 1, std::memory_order_release);
+    }
+}
+
+// Try dequeue: local primeiro, depois roubo a partir de um shard aleatório
+template<class T>
+bool ShardedQueue<T>::tryDequeue(T& out) {
+    if (mode == ShardOrdering::StrictFifo) {
+        return dequeueStrict([&out](T&& value) { out = std::move(value); });
+    }
+
+    size_t local = localShard();
+    if (dequeueFrom(shards[local], out)) {
+        return true;
+    }
+
+    size_t count = shards.size();
+    size_t start = static_cast<size_t>(nextRandom() % count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t victim = (start + i) % count;
+        if (victim != local && dequeueFrom(shards[victim], out)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Bulk: em Relaxed, esvazia lotes shard a shard com Queue::dequeueBulk
+template<class T>
+template<typename OutputIt>
+size_t ShardedQueue<T>::tryDequeueBulk(OutputIt out, size_t maxCount) {
+    size_t removed = 0;
+
+    if (mode == ShardOrdering::StrictFifo) {
+        auto deliver = [&out](T&& value) {
+            *out = std::move(value);
+            ++out;
+        };
+        while (removed < maxCount && dequeueStrict(deliver)) {
+            ++removed;
+        }
+        return removed;
+    }
+
+    // Adapta out para receber Entry e gravar só o valor
+    struct ValueWriter {
+        OutputIt* target;
+        ValueWriter& operator*() { return *this; }
+        ValueWriter& operator++() { return *this; }
+        ValueWriter& operator=(Entry&& entry) {
+            **target = std::move(entry.value);
+            ++*target;
+            return *this;
+        }
+    };
+
+    size_t count = shards.size();
+    size_t local = localShard();
+    size_t start = static_cast<size_t>(nextRandom() % count);
+    for (size_t i = 0; i <= count && removed < maxCount; ++i) {
+        // Primeira visita ao shard local, depois os demais a partir de start
+        size_t index = i == 0 ? local : (start + i - 1) % count;
+        if (i > 0 && index == local) {
+            continue;
+        }
+        Shard& shard = shards[index];
+        if (shard.count.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size_t before = shard.items.size();
+        try {
+            removed += shard.items.dequeueBulk(ValueWriter{&out}, maxCount - removed);
+        } catch (...) {
+            // dequeueBulk retira os já gravados em out antes de relançar
+            shard.count.fetch_sub(before - shard.items.size(), std::memory_order_relaxed);
+            throw;
+        }
+        shard.count.fetch_sub(before - shard.items.size(), std::memory_order_relaxed);
+    }
+    return removed;
+}
+
+// Consulta
+template<class T>
+size_t ShardedQueue<T>::sizeApprox() const {
+    size_t total = 0;
+    for (const Shard& shard : shards) {
+        total += shard.count.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+template<class T>
+bool ShardedQueue<T>::emptyApprox() const {
+    return sizeApprox() == 0;
+}
+
+template<class T>
+size_t ShardedQueue<T>::shardCount() const {
+    return shards.size();
+}
+
+template<class T>
+ShardOrdering ShardedQueue<T>::ordering() const {
+    return mode;
+}
+
+#endif // SHARDEDQUEUE_H
@@ -0,0 +1,275 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+// Fila limitada lock-free para exatamente um produtor e um consumidor.
+// Índices crescem monotonicamente e são mapeados no buffer por máscara
+// (capacidade potência de dois). Cada lado escreve só o próprio índice
+// (release) e lê o do outro (acquire); nenhuma operação usa CAS.
+// Cada lado guarda uma cópia local do índice do outro e só relê o
+// atômico quando a cópia indica fila cheia/vazia, evitando que a linha
+// de cache do outro lado seja puxada a cada operação.
+//
+// Regras de uso: enqueue/emplace/tryEnqueue apenas na thread produtora;
+// dequeue/front/tryDequeue apenas na thread consumidora.
+template<class T>
+class SpscQueue {
+private:
+    static constexpr size_t cacheLine = 64;
+
+    // Lado do produtor: escrito pelo produtor, tail lido pelo consumidor
+    struct alignas(cacheLine) ProducerSide {
+        std::atomic<size_t> tail;
+        size_t cachedHead; // Última leitura de head (local do produtor)
+    };
+
+    // Lado do consumidor: escrito pelo consumidor, head lido pelo produtor
+    struct alignas(cacheLine) ConsumerSide {
+        std::atomic<size_t> head;
+        size_t cachedTail; // Última leitura de tail (local do consumidor)
+    };
+
+    // Somente leitura após a construção
+    struct alignas(cacheLine) Storage {
+        T* slots;
+        size_t mask;
+    };
+
+    Storage storage;
+    ProducerSide producer;
+    ConsumerSide consumer;
+
+    static size_t roundCapacity(size_t requested);
+
+    template<typename... Args>
+    bool tryConstruct(Args&&... args);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor com capacidade (arredondada para potência de dois)
+    explicit SpscQueue(size_t capacity);
+
+    // Destrutor (sem produtor nem consumidor ativos)
+    ~SpscQueue();
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // ==================== PRODUTOR ====================
+
+    // Tenta enfileirar; retorna false se estiver cheia
+    bool tryEnqueue(const T& value);
+    bool tryEnqueue(T&& value);
+
+    template<typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    // Enfileira esperando (spin + yield) enquanto estiver cheia
+    void enqueue(const T& value);
+    void enqueue(T&& value);
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // ==================== CONSUMIDOR ====================
+
+    // Tenta remover o primeiro elemento para out; retorna false se vazia
+    bool tryDequeue(T& out);
+
+    // Remove o primeiro elemento
+    void dequeue();
+
+    // Remove e retorna o primeiro elemento
+    T dequeueAndReturn();
+
+    // Acessa o primeiro elemento (válido até o próximo dequeue)
+    T& front();
+
+    // Ponteiro para o primeiro elemento ou nullptr se vazia
+    T* peek();
+
+    // ==================== CONSULTA ====================
+
+    // Vazia do ponto de vista do consumidor
+    bool empty() const;
+
+    // Tamanho aproximado (exato se chamado sem concorrência)
+    size_t sizeApprox() const;
+
+    size_t capacity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+template<class T>
+size_t SpscQueue<T>::roundCapacity(size_t requested) {
+    if (requested == 0) {
+        throw std::invalid_argument("SpscQueue capacity must be positive");
+    }
+    size_t capacity = 1;
+    while (capacity < requested) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// Construtor
+template<class T>
+SpscQueue<T>::SpscQueue(size_t capacity) {
+    size_t rounded = roundCapacity(capacity);
+    storage.slots = static_cast<T*>(::operator new(rounded * sizeof(T)));
+    storage.mask = rounded - 1;
+    producer.tail.store(0, std::memory_order_relaxed);
+    producer.cachedHead = 0;
+    consumer.head.store(0, std::memory_order_relaxed);
+    consumer.cachedTail = 0;
+}
+
+// Destrutor
+template<class T>
+SpscQueue<T>::~SpscQueue() {
+    size_t head = consumer.head.load(std::memory_order_relaxed);
+    size_t tail = producer.tail.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) {
+        storage.slots[head & storage.mask].~T();
+    }
+    ::operator delete(storage.slots);
+}
+
+// Produtor: relê head só quando a cópia local indica fila cheia
+template<class T>
+template<typename... Args>
+bool SpscQueue<T>::tryConstruct(Args&&... args) {
+    size_t tail = producer.tail.load(std::memory_order_relaxed);
+    if (tail - producer.cachedHead > storage.mask) {
+        producer.cachedHead = consumer.head.load(std::memory_order_acquire);
+        if (tail - producer.cachedHead > storage.mask) {
+            return false;
+        }
+    }
+
+    new (storage.slots + (tail & storage.mask)) T(std::forward<Args>(args)...);
+    producer.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T>
+bool SpscQueue<T>::tryEnqueue(const T& value) {
+    return tryConstruct(value);
+}
+
+template<class T>
+bool SpscQueue<T>::tryEnqueue(T&& value) {
+    return tryConstruct(std::move(value));
+}
+
+template<class T>
+template<typename... Args>
+bool SpscQueue<T>::tryEmplace(Args&&... args) {
+    return tryConstruct(std::forward<Args>(args)...);
+}
+
+template<class T>
+void SpscQueue<T>::enqueue(const T& value) {
+    while (!tryConstruct(value)) {
+        std::this_thread::yield();
+    }
+}
+
+template<class T>
+void SpscQueue<T>::enqueue(T&& value) {
+    // tryConstruct só move quando há espaço
+    while (!tryConstruct(std::move(value))) {
+        std::this_thread::yield();
+    }
+}
+
+template<class T>
+template<typename... Args>
+void SpscQueue<T>::emplace(Args&&... args) {
+    while (!tryConstruct(std::forward<Args>(args)...)) {
+        std::this_thread::yield();
+    }
+}
+
+// Consumidor: relê tail só quando a cópia local indica fila vazia
+template<class T>
+T* SpscQueue<T>::peek() {
+    size_t head = consumer.head.load(std::memory_order_relaxed);
+    if (head == consumer.cachedTail) {
+        consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+        if (head == consumer.cachedTail) {
+            return nullptr;
+        }
+    }
+    return storage.slots + (head & storage.mask);
+}
+
+template<class T>
+T& SpscQueue<T>::front() {
+    T* first = peek();
+    if (first == nullptr) {
+        throw std::underflow_error("Queue is empty");
+    }
+    return *first;
+}
+
+template<class T>
+void SpscQueue<T>::dequeue() {
+    T* first = peek();
+    if (first == nullptr) {
+        throw std::underflow_error("Queue is empty");
+    }
+    first->~T();
+    consumer.head.store(consumer.head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+template<class T>
+T SpscQueue<T>::dequeueAndReturn() {
+    T* first = peek();
+    if (first == nullptr) {
+        throw std::underflow_error("Queue is empty");
+    }
+    T value = std::move(*first);
+    first->~T();
+    consumer.head.store(consumer.head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return value;
+}
+
+template<class T>
+bool SpscQueue<T>::tryDequeue(T& out) {
+    T* first = peek();
+    if (first == nullptr) {
+        return false;
+    }
+    out = std::move(*first);
+    first->~T();
+    consumer.head.store(consumer.head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+// Consulta
+template<class T>
+bool SpscQueue<T>::empty() const {
+    return consumer.head.load(std::memory_order_relaxed) == producer.tail.load(std::memory_order_acquire);
+}
+
+template<class T>
+size_t SpscQueue<T>::sizeApprox() const {
+    size_t head = consumer.head.load(std::memory_order_acquire);
+    size_t tail = producer.tail.load(std::memory_order_acquire);
+    return tail >= head ? tail - head : 0;
+}
+
+template<class T>
+size_t SpscQueue<T>::capacity() const {
+    return storage.mask + 1;
+}
+
+#endif // SPSCQUEUE_H
@@ -7,11 +7,14 @@
 #include <functional>
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include "OutputBuffer.h"
+#include "MemoryUsage.h"
 
 template<class T>
 class Stack {
 private:
-    class Node {
+    class Node : public CountedNode<ContainerKind::Stack> {
     public:
         T data;
         Node* next;
@@ -27,6 +30,23 @@ private:
     Node* topNode;      
     size_t stackSize;
     
+    // Escreve os elementos no buffer (usado por operator<<, print e writeTo)
+    void writeElements(OutputBuffer& out, size_t previewCount) const;
+    
+    // Cadeia de nós ainda não ligada à pilha (top = último elemento do intervalo)
+    struct NodeChain {
+        Node* top;
+        Node* bottom;
+        size_t length;
+    };
+    
+    // Aloca e encadeia os nós de [first, last); libera tudo se uma cópia lançar
+    template<typename InputIt>
+    static NodeChain buildChain(InputIt first, InputIt last);
+    
+    // Liga a cadeia sobre o topo atual e atualiza o tamanho uma vez
+    void linkChain(const NodeChain& chain);
+    
 public:
     // ==================== CONSTRUTORES E DESTRUTOR ====================
     // Construtor padrão
@@ -41,6 +61,10 @@ public:
     // Construtor com lista de inicialização
     Stack(std::initializer_list<T> init);
     
+    // Construtor a partir de intervalo de iteradores (último elemento no topo)
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Stack(InputIt first, InputIt last);
+    
     // Destrutor
     ~Stack();
     
@@ -60,6 +84,18 @@ public:
     // Adiciona elemento no topo (versão move)
     void push(T&& value);
     
+    // Empilha um intervalo em lote, na ordem (último elemento fica no topo)
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void push(InputIt first, InputIt last);
+    
+    // Empilha um intervalo inteiro (move os elementos se receber rvalue)
+    template<typename Range>
+    void pushRange(Range&& range);
+    
+    // Substitui o conteúdo (último elemento no topo)
+    template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
+    
     // Constrói elemento in-place no topo
     template<typename... Args>
     void emplace(Args&&... args);
@@ -84,6 +120,9 @@ public:
     // Retorna o tamanho
     size_t size() const;
     
+    // Memória ocupada: nós, payload, slack do alocador e DeepSize<T>
+    MemoryUsage memoryUsage() const;
+    
     // Verifica se contém um elemento
     bool contains(const T& value) const;
     
@@ -161,6 +200,11 @@ public:
     // Imprime estrutura da pilha
     void print() const;
     
+    // Escrita bufferizada no formato de operator<<
+    // (previewCount > 0 mostra só os primeiros e últimos previewCount elementos)
+    void writeTo(std::ostream& os, size_t previewCount = 0) const;
+    void writeTo(int fd, size_t previewCount = 0) const;
+    
     // Verifica integridade da estrutura
     bool checkIntegrity() const;
 };
@@ -197,9 +241,14 @@ Stack<T>::Stack(Stack&& other) noexcept : topNode(other.topNode), stackSize(othe
 // Construtor com lista de inicialização
 template<class T>
 Stack<T>::Stack(std::initializer_list<T> init) : topNode(nullptr), stackSize(0) {
-    for (const auto& item : init) {
-        push(item);
-    }
+    linkChain(buildChain(init.begin(), init.end()));
+}
+
+// Construtor a partir de intervalo
+template<class T>
+template<typename InputIt, typename>
+Stack<T>::Stack(InputIt first, InputIt last) : topNode(nullptr), stackSize(0) {
+    linkChain(buildChain(first, last));
 }
 
 // Destrutor
@@ -214,17 +263,12 @@ Stack<T>& Stack<T>::operator=(const Stack& other) {
     if (this != &other) {
         clear();
         
-        // Copia os elementos na ordem correta
-        std::vector<T> temp;
-        Node* current = other.topNode;
-        while (current != nullptr) {
-            temp.push_back(current->data);
-            current = current->next;
-        }
-        
-        // Insere na ordem inversa para manter a estrutura
-        for (auto it = temp.rbegin(); it != temp.rend(); ++it) {
-            push(*it);
+        // Copia do topo para a base, ligando cada nó abaixo do anterior
+        Node** link = &topNode;
+        for (Node* current = other.topNode; current != nullptr; current = current->next) {
+            *link = new Node(current->data);
+            link = &(*link)->next;
+            ++stackSize;
         }
     }
     return *this;
@@ -261,6 +305,73 @@ void Stack<T>::push(T&& value) {
     ++stackSize;
 }
 
+// Build chain: cada novo nó fica acima do anterior
+template<class T>
+template<typename InputIt>
+typename Stack<T>::NodeChain Stack<T>::buildChain(InputIt first, InputIt last) {
+    NodeChain chain{nullptr, nullptr, 0};
+    
+    try {
+        for (; first != last; ++first) {
+            Node* newNode = new Node(*first);
+            newNode->next = chain.top;
+            if (chain.bottom == nullptr) {
+                chain.bottom = newNode;
+            }
+            chain.top = newNode;
+            ++chain.length;
+        }
+    } catch (...) {
+        while (chain.top != nullptr) {
+            Node* next = chain.top->next;
+            delete chain.top;
+            chain.top = next;
+        }
+        throw;
+    }
+    
+    return chain;
+}
+
+// Link chain
+template<class T>
+void Stack<T>::linkChain(const NodeChain& chain) {
+    if (chain.length == 0) {
+        return;
+    }
+    chain.bottom->next = topNode;
+    topNode = chain.top;
+    stackSize += chain.length;
+}
+
+// Push em lote
+template<class T>
+template<typename InputIt, typename>
+void Stack<T>::push(InputIt first, InputIt last) {
+    linkChain(buildChain(first, last));
+}
+
+template<class T>
+template<typename Range>
+void Stack<T>::pushRange(Range&& range) {
+    using std::begin;
+    using std::end;
+    if constexpr (std::is_rvalue_reference<Range&&>::value) {
+        linkChain(buildChain(std::make_move_iterator(begin(range)), std::make_move_iterator(end(range))));
+    } else {
+        linkChain(buildChain(begin(range), end(range)));
+    }
+}
+
+// Assign: monta a cadeia antes de limpar (a pilha fica intacta se uma cópia lançar)
+template<class T>
+template<typename InputIt, typename>
+void Stack<T>::assign(InputIt first, InputIt last) {
+    NodeChain chain = buildChain(first, last);
+    clear();
+    linkChain(chain);
+}
+
 // Emplace
 template<class T>
 template<typename... Args>
@@ -325,6 +436,22 @@ size_t Stack<T>::size() const {
     return stackSize;
 }
 
+// Memory usage (percorre os elementos só se DeepSize<T> for indireto)
+template<class T>
+MemoryUsage Stack<T>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    usage.nodeBytes = stackSize * sizeof(Node);
+    usage.payloadBytes = stackSize * sizeof(T);
+    usage.slackBytes = stackSize * allocationSlack(sizeof(Node));
+    if (DeepSize<T>::indirect) {
+        for (Node* current = topNode; current != nullptr; current = current->next) {
+            usage.deepBytes += DeepSize<T>::of(current->data);
+        }
+    }
+    return usage;
+}
+
 // Contains
 template<class T>
 bool Stack<T>::contains(const T& value) const {
@@ -586,25 +713,80 @@ bool Stack<T>::operator!=(const Stack& other) const {
     return !(*this == other);
 }
 
-// Print
+// Print (bufferizado; termina com '\n' sem forçar flush)
 template<class T>
 void Stack<T>::print() const {
-    std::cout << "Stack [size=" << stackSize << "]: ";
+    OutputBuffer out(std::cout);
+    out.append("Stack [size=");
+    out.appendValue(stackSize);
+    out.append("]: ");
     if (empty()) {
-        std::cout << "(empty)";
+        out.append("(empty)");
     } else {
-        std::cout << "TOP -> ";
+        out.append("TOP -> ");
         Node* current = topNode;
         while (current != nullptr) {
-            std::cout << current->data;
+            out.appendValue(current->data);
             if (current->next != nullptr) {
-                std::cout << " -> ";
+                out.append(" -> ", 4);
             }
             current = current->next;
         }
-        std::cout << " -> BASE";
+        out.append(" -> BASE");
+    }
+    out.append('\n');
+    out.flush();
+}
+
+// Escreve "[a, b, c]" ou, em modo preview, "[a, b, ... (n omitted), y, z]"
+template<class T>
+void Stack<T>::writeElements(OutputBuffer& out, size_t previewCount) const {
+    bool truncated = previewCount > 0 && 2 * previewCount < stackSize;
+    size_t leading = truncated ? previewCount : stackSize;
+    
+    out.append('[');
+    Node* current = topNode;
+    for (size_t i = 0; i < leading; ++i) {
+        if (i > 0) {
+            out.append(", ", 2);
+        }
+        out.appendValue(current->data);
+        current = current->next;
+    }
+    
+    if (truncated) {
+        out.append(", ... (");
+        out.appendValue(stackSize - 2 * previewCount);
+        out.append(" omitted)");
+        
+        // Lista simplesmente encadeada: avança sem formatar até os últimos
+        for (size_t i = leading; i < stackSize - previewCount; ++i) {
+            current = current->next;
+        }
+        while (current != nullptr) {
+            out.append(", ", 2);
+            out.appendValue(current->data);
+            current = current->next;
+        }
     }
-    std::cout << std::endl;
+    out.append(']');
+}
+
+// Write to
+template<class T>
+void Stack<T>::writeTo(std::ostream& os, size_t previewCount) const {
+    OutputBuffer out(os);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
+}
+
+template<class T>
+void Stack<T>::writeTo(int fd, size_t previewCount) const {
+    OutputBuffer out(fd);
+    writeElements(out, previewCount);
+    out.append('\n');
+    out.flush();
 }
 
 // Check integrity
@@ -622,18 +804,9 @@ bool Stack<T>::checkIntegrity() const {
 // Operador de saída
 template<class T>
 std::ostream& operator<<(std::ostream& os, const Stack<T>& stack) {
-    os << "[";
-    typename Stack<T>::Node* current = stack.topNode;
-    bool first = true;
-    while (current != nullptr) {
-        if (!first) {
-            os << ", ";
-        }
-        os << current->data;
-        first = false;
-        current = current->next;
-    }
-    os << "]";
+    OutputBuffer out(os);
+    stack.writeElements(out, 0);
+    out.flush();
     return os;
 }
 
@@ -0,0 +1,203 @@
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Deque de roubo de trabalho (Chase-Lev, com as ordens de memória de
+// Lê, Pop, Cohen e Nardelli, "Correct and Efficient Work-Stealing for
+// Weak Memory Models").
+// O dono empilha e desempilha em bottom; ladrões roubam em top com CAS.
+// push do dono não usa operação atômica de leitura-modificação-escrita
+// (só loads/stores relaxed e uma fence release); pop só disputa com os
+// ladrões (CAS) quando resta um único elemento.
+//
+// O array circular dobra quando enche. Ladrões podem estar lendo o array
+// antigo, então ele não é liberado na hora: fica numa lista de
+// aposentados até a destruição do deque (no máximo o dobro da memória
+// do maior array).
+//
+// T deve ser trivialmente copiável (tipicamente um ponteiro para tarefa):
+// um ladrão lê o slot antes de saber se ganhou o CAS.
+//
+// Regras de uso: push/pop apenas na thread dona; steal em qualquer thread.
+template<class T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque requires a trivially copyable T");
+
+private:
+    static constexpr size_t cacheLine = 64;
+
+    struct Array {
+        size_t capacity;          // Potência de dois
+        std::atomic<T>* slots;
+        Array* retired;           // Array anterior (aposentado)
+
+        explicit Array(size_t size) : capacity(size), slots(new std::atomic<T>[size]), retired(nullptr) {}
+        ~Array() { delete[] slots; }
+
+        T get(int64_t index) const {
+            return slots[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t index, T value) {
+            slots[static_cast<size_t>(index) & (capacity - 1)].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(cacheLine) std::atomic<int64_t> top;
+    alignas(cacheLine) std::atomic<int64_t> bottom;
+    std::atomic<Array*> array;
+
+    // Dono: dobra o array copiando [first, last)
+    Array* grow(Array* current, int64_t first, int64_t last);
+
+public:
+    // ==================== CONSTRUTORES E DESTRUTOR ====================
+    // Construtor com capacidade inicial (arredondada para potência de dois)
+    explicit WorkStealingDeque(size_t initialCapacity = 64);
+
+    // Destrutor (sem dono nem ladrões ativos)
+    ~WorkStealingDeque();
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // ==================== DONO ====================
+
+    // Empilha em bottom (cresce se necessário)
+    void push(T value);
+
+    // Desempilha de bottom (LIFO); retorna false se vazio
+    bool pop(T& out);
+
+    // ==================== LADRÕES ====================
+
+    // Rouba de top (FIFO); retorna false se vazio ou se perdeu a disputa
+    // para outro ladrão ou para o dono
+    bool steal(T& out);
+
+    // ==================== CONSULTA ====================
+
+    // Tamanho aproximado (exato se chamado sem concorrência)
+    size_t sizeApprox() const;
+    bool emptyApprox() const;
+    size_t capacity() const;
+};
+
+// ==================== IMPLEMENTAÇÕES INLINE ====================
+
+// Construtor
+template<class T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t initialCapacity) : top(0), bottom(0) {
+    size_t size = 2;
+    while (size < initialCapacity) {
+        size *= 2;
+    }
+    array.store(new Array(size), std::memory_order_relaxed);
+}
+
+// Destrutor: libera o array atual e todos os aposentados
+template<class T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+    Array* current = array.load(std::memory_order_relaxed);
+    while (current != nullptr) {
+        Array* previous = current->retired;
+        delete current;
+        current = previous;
+    }
+}
+
+// Grow
+template<class T>
+typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::grow(Array* current, int64_t first, int64_t last) {
+    Array* bigger = new Array(current->capacity * 2);
+    for (int64_t i = first; i < last; ++i) {
+        bigger->put(i, current->get(i));
+    }
+    bigger->retired = current;
+    array.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+// Push
+template<class T>
+void WorkStealingDeque<T>::push(T value) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    Array* current = array.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(current->capacity) - 1) {
+        current = grow(current, t, b);
+    }
+    current->put(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+// Pop: reserva bottom antes de ler top; a fence seq_cst ordena essa
+// reserva contra o load de top dos ladrões
+template<class T>
+bool WorkStealingDeque<T>::pop(T& out) {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    Array* current = array.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // Vazio
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    out = current->get(b);
+    if (t == b) {
+        // Último elemento: disputa com os ladrões
+        bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+// Steal
+template<class T>
+bool WorkStealingDeque<T>::steal(T& out) {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+        return false;
+    }
+
+    Array* current = array.load(std::memory_order_acquire);
+    T value = current->get(t);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+// Consulta
+template<class T>
+size_t WorkStealingDeque<T>::sizeApprox() const {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+template<class T>
+bool WorkStealingDeque<T>::emptyApprox() const {
+    return sizeApprox() == 0;
+}
+
+template<class T>
+size_t WorkStealingDeque<T>::capacity() const {
+    return array.load(std::memory_order_relaxed)->capacity;
+}
+
+#endif // WORKSTEALINGDEQUE_H
@@ -0,0 +1,175 @@
+// Benchmark do BlockingQueue: latência de despertar de um consumidor
+// ocioso, CPU gasta esperando e vazão com contrapressão, contra o
+// consumidor que consulta empty() em laço num Queue com mutex.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/BlockingQueueBench.cpp -o blocking_bench
+// Argumento opcional: mensagens da medida de vazão (padrão 1000000).
+// Em uma máquina de um núcleo, quem faz polling disputa o núcleo com o
+// produtor, o que aparece tanto na latência quanto na CPU gasta.
+
+#include "BlockingQueue.h"
+#include "Queue.h"
+#include "TestSupport.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// CPU consumida pelo thread atual, em milissegundos
+double threadCpuMs() {
+    timespec spec;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &spec);
+    return static_cast<double>(spec.tv_sec) * 1e3 + static_cast<double>(spec.tv_nsec) / 1e6;
+}
+
+// Referência: consumidor que consulta empty() em laço, como antes do BlockingQueue
+struct PollingQueue {
+    std::mutex mutex;
+    Queue<long> queue;
+    std::atomic<bool> done{false};
+
+    void enqueue(long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(value);
+    }
+
+    void close() { done.store(true); }
+
+    bool waitDequeue(long& out) {
+        while (true) {
+            // done lido antes: o que foi enfileirado antes de close() ainda sai
+            bool finished = done.load();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!queue.empty()) {
+                    out = queue.dequeueAndReturn();
+                    return true;
+                }
+            }
+            if (finished) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+};
+
+struct Blocking {
+    BlockingQueue<long> queue;
+
+    void enqueue(long value) { queue.waitEnqueue(value); }
+    void close() { queue.close(); }
+    bool waitDequeue(long& out) { return queue.waitDequeue(out); }
+};
+
+// Mensagens espaçadas por gap: o consumidor está ocioso quando cada uma
+// chega. Mede do envio ao recebimento e a CPU do consumidor no período.
+template<typename Channel>
+void wakeLatency(const char* label, std::chrono::microseconds gap, int messages) {
+    Channel channel;
+    std::vector<long> latencies;
+    double consumerCpu = 0;
+
+    std::thread consumer([&] {
+        double cpuStart = threadCpuMs();
+        long stamp;
+        while (channel.waitDequeue(stamp)) {
+            latencies.push_back(nowNs() - stamp);
+        }
+        consumerCpu = threadCpuMs() - cpuStart;
+    });
+
+    double wallMs = test_support::measureMs([&] {
+        for (int i = 0; i < messages; ++i) {
+            std::this_thread::sleep_for(gap);
+            channel.enqueue(nowNs());
+        }
+        channel.close();
+        consumer.join();
+    });
+
+    STRESS_CHECK(latencies.size() == static_cast<size_t>(messages));
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+        return static_cast<double>(latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))]) / 1e3;
+    };
+    std::printf("%-28s intervalo %5lld us: mediana %8.1f us, p99 %8.1f us, CPU do consumidor %5.1f%%\n", label,
+                static_cast<long long>(gap.count()), percentile(0.5), percentile(0.99),
+                100.0 * consumerCpu / wallMs);
+}
+
+// Vazão com capacidade limitada: produtores esperam com waitEnqueue
+void throughput(int producers, int consumers, long total) {
+    BlockingQueue<long> queue(1024);
+    long perProducer = total / producers;
+    std::atomic<long> sum{0};
+    std::atomic<int> producersLeft{producers};
+
+    double ms = test_support::measureMs([&] {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&] {
+                for (long i = 0; i < perProducer; ++i) {
+                    queue.waitEnqueue(i);
+                }
+                if (producersLeft.fetch_sub(1) == 1) {
+                    queue.close();
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                long value;
+                long local = 0;
+                while (queue.waitDequeue(value)) {
+                    local += value;
+                }
+                sum.fetch_add(local);
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+
+    STRESS_CHECK(sum.load() == producers * (perProducer * (perProducer - 1) / 2));
+    std::string name = "vazão " + std::to_string(producers) + "P/" + std::to_string(consumers) + "C cap 1024";
+    test_support::report(name.c_str(), ms, static_cast<double>(perProducer * producers));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long total = argc > 1 ? std::atol(argv[1]) : 1000000;
+    if (total <= 0) {
+        std::fprintf(stderr, "uso: %s [mensagens]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("%u threads de hardware\n", std::thread::hardware_concurrency());
+    for (long gap : {50L, 200L, 1000L}) {
+        wakeLatency<Blocking>("BlockingQueue", std::chrono::microseconds(gap), 500);
+        wakeLatency<PollingQueue>("Queue + mutex com polling", std::chrono::microseconds(gap), 500);
+    }
+    for (int producers : {1, 4}) {
+        for (int consumers : {1, 4}) {
+            throughput(producers, consumers, total);
+        }
+    }
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+// Benchmark da Cache: taxa de acerto e latência média de get/put sob
+// acessos com distribuição de Zipf, para LRU e LFU.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -I. tests/CacheBench.cpp -o cache_bench
+// Argumentos opcionais: número de acessos (padrão 2000000) e número de
+// chaves distintas (padrão 100000).
+// Cada acesso faz get e, se errar, put. A sequência de chaves é gerada
+// antes da medida e é a mesma para todas as configurações.
+
+#include "Cache.h"
+#include "TestSupport.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Chaves 0..keyCount-1 com P(k) proporcional a 1 / (k + 1)^exponent
+std::vector<int> zipfTrace(size_t accesses, size_t keyCount, double exponent, unsigned seed) {
+    std::vector<double> cdf(keyCount);
+    double total = 0;
+    for (size_t k = 0; k < keyCount; ++k) {
+        total += 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+        cdf[k] = total;
+    }
+
+    // Embaralha os ranks para que as chaves quentes não sejam as menores
+    std::vector<int> keyOfRank(keyCount);
+    for (size_t k = 0; k < keyCount; ++k) {
+        keyOfRank[k] = static_cast<int>(k);
+    }
+    std::mt19937_64 random(seed);
+    std::shuffle(keyOfRank.begin(), keyOfRank.end(), random);
+
+    std::uniform_real_distribution<double> uniform(0.0, total);
+    std::vector<int> trace(accesses);
+    for (int& key : trace) {
+        size_t rank = static_cast<size_t>(std::lower_bound(cdf.begin(), cdf.end(), uniform(random)) - cdf.begin());
+        key = keyOfRank[std::min(rank, keyCount - 1)];
+    }
+    return trace;
+}
+
+void run(const std::vector<int>& trace, size_t capacity, CachePolicy policy, double exponent) {
+    Cache<int, long> cache(capacity, policy);
+    long checksum = 0;
+    double ms = test_support::measureMs([&] {
+        for (int key : trace) {
+            long* value = cache.get(key);
+            if (value != nullptr) {
+                checksum += *value;
+            } else {
+                cache.put(key, key);
+            }
+        }
+    });
+    test_support::keep(checksum);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s s=%.2f cap=%zu", policy == CachePolicy::LRU ? "LRU" : "LFU",
+                  exponent, capacity);
+    test_support::report(name, ms, static_cast<double>(trace.size()));
+    std::printf("%-40s taxa de acerto %.4f, %zu remoções\n", "", cache.hitRate(), cache.evictions());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long accesses = argc > 1 ? std::atol(argv[1]) : 2000000;
+    long keyCount = argc > 2 ? std::atol(argv[2]) : 100000;
+    if (accesses <= 0 || keyCount <= 0) {
+        std::fprintf(stderr, "uso: %s [acessos] [chaves]\n", argv[0]);
+        return 2;
+    }
+
+    for (double exponent : {0.8, 0.99, 1.2}) {
+        std::vector<int> trace = zipfTrace(static_cast<size_t>(accesses), static_cast<size_t>(keyCount), exponent, 35);
+        for (size_t divisor : {100, 10}) {
+            size_t capacity = std::max<size_t>(1, static_cast<size_t>(keyCount) / divisor);
+            run(trace, capacity, CachePolicy::LRU, exponent);
+            run(trace, capacity, CachePolicy::LFU, exponent);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+// Benchmark do DelayQueue: agendar muitos timers, cancelar metade e
+// consultar os vencidos a cada tick, contra um heap (PriorityQueue com
+// erase por handle) e contra a varredura de um Queue a cada tick.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -I. tests/DelayQueueBench.cpp -o delay_queue_bench
+// Argumentos opcionais: timers (padrão 1000000) e ticks (padrão 10000).
+// A varredura do Queue custa O(n) por tick; ela roda com 1% dos timers.
+
+#include "DelayQueue.h"
+#include "PriorityQueue.h"
+#include "Queue.h"
+#include "TestSupport.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Tick = uint64_t;
+
+struct Timer {
+    Tick deadline;
+    uint32_t id;
+};
+
+// Deadlines sorteados em (0, ticks]; metade dos timers é cancelada
+std::vector<Timer> makeTimers(size_t count, Tick ticks) {
+    std::mt19937_64 random(49);
+    std::vector<Timer> timers(count);
+    for (size_t i = 0; i < count; ++i) {
+        timers[i] = Timer{1 + random() % ticks, static_cast<uint32_t>(i)};
+    }
+    return timers;
+}
+
+bool cancelled(uint32_t id) {
+    return id % 2 == 1;
+}
+
+// Soma dos ids que devem expirar: confere que cada medida entregou os mesmos
+uint64_t expectedSum(const std::vector<Timer>& timers) {
+    uint64_t sum = 0;
+    for (const Timer& timer : timers) {
+        if (!cancelled(timer.id)) {
+            sum += timer.id;
+        }
+    }
+    return sum;
+}
+
+void delayQueue(const std::vector<Timer>& timers, Tick ticks) {
+    uint64_t sum = 0;
+    double ms = test_support::measureMs([&] {
+        DelayQueue<uint32_t> queue;
+        std::vector<DelayQueue<uint32_t>::Handle> handles;
+        handles.reserve(timers.size());
+        for (const Timer& timer : timers) {
+            handles.push_back(queue.schedule(timer.deadline, timer.id));
+        }
+        for (const Timer& timer : timers) {
+            if (cancelled(timer.id)) {
+                queue.cancel(handles[timer.id]);
+            }
+        }
+        std::vector<uint32_t> expired;
+        for (Tick now = 1; now <= ticks; ++now) {
+            expired.clear();
+            queue.pollExpired(now, expired);
+            for (uint32_t id : expired) {
+                sum += id;
+            }
+        }
+    });
+    STRESS_CHECK(sum == expectedSum(timers));
+    std::string name = "DelayQueue " + std::to_string(timers.size()) + " timers";
+    test_support::report(name.c_str(), ms, static_cast<double>(timers.size()));
+}
+
+// Menor deadline = maior prioridade
+struct Entry {
+    Tick deadline;
+    uint32_t id;
+
+    bool operator<(const Entry& other) const { return deadline > other.deadline; }
+};
+
+void heap(const std::vector<Timer>& timers, Tick ticks) {
+    uint64_t sum = 0;
+    double ms = test_support::measureMs([&] {
+        PriorityQueue<Entry> queue;
+        std::vector<PriorityQueue<Entry>::Handle> handles;
+        handles.reserve(timers.size());
+        for (const Timer& timer : timers) {
+            handles.push_back(queue.enqueue(Entry{timer.deadline, timer.id}));
+        }
+        for (const Timer& timer : timers) {
+            if (cancelled(timer.id)) {
+                queue.erase(handles[timer.id]);
+            }
+        }
+        for (Tick now = 1; now <= ticks; ++now) {
+            while (!queue.empty() && queue.front().deadline <= now) {
+                sum += queue.dequeueAndReturn().id;
+            }
+        }
+    });
+    STRESS_CHECK(sum == expectedSum(timers));
+    std::string name = "PriorityQueue " + std::to_string(timers.size()) + " timers";
+    test_support::report(name.c_str(), ms, static_cast<double>(timers.size()));
+}
+
+// Como antes do DelayQueue: a cada tick, percorre a fila inteira e
+// devolve ao fim os que ainda não venceram
+void scan(const std::vector<Timer>& timers, Tick ticks) {
+    uint64_t sum = 0;
+    double ms = test_support::measureMs([&] {
+        Queue<Timer> queue;
+        std::vector<bool> live(timers.size(), true);
+        for (const Timer& timer : timers) {
+            queue.enqueue(timer);
+        }
+        for (const Timer& timer : timers) {
+            if (cancelled(timer.id)) {
+                live[timer.id] = false;
+            }
+        }
+        for (Tick now = 1; now <= ticks; ++now) {
+            for (size_t pending = queue.size(); pending > 0; --pending) {
+                Timer timer = queue.dequeueAndReturn();
+                if (!live[timer.id]) {
+                    continue;
+                }
+                if (timer.deadline <= now) {
+                    sum += timer.id;
+                } else {
+                    queue.enqueue(timer);
+                }
+            }
+        }
+    });
+    STRESS_CHECK(sum == expectedSum(timers));
+    std::string name = "Queue varrido " + std::to_string(timers.size()) + " timers";
+    test_support::report(name.c_str(), ms, static_cast<double>(timers.size()));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+    long ticks = argc > 2 ? std::atol(argv[2]) : 10000;
+    if (count <= 0 || ticks <= 0) {
+        std::fprintf(stderr, "uso: %s [timers] [ticks]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("== agenda, cancela metade e consulta a cada tick por %ld ticks\n", ticks);
+    std::vector<Timer> timers = makeTimers(static_cast<size_t>(count), static_cast<Tick>(ticks));
+    delayQueue(timers, static_cast<Tick>(ticks));
+    heap(timers, static_cast<Tick>(ticks));
+
+    size_t fewCount = static_cast<size_t>(count / 100 > 0 ? count / 100 : 1);
+    std::vector<Timer> few = makeTimers(fewCount, static_cast<Tick>(ticks));
+    delayQueue(few, static_cast<Tick>(ticks));
+    heap(few, static_cast<Tick>(ticks));
+    scan(few, static_cast<Tick>(ticks));
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
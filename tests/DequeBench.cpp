@@ -0,0 +1,143 @@
+// Benchmark do Deque contra o List nos padrões de uso que motivaram o
+// Deque: inserções nas duas pontas, fila FIFO, janela deslizante, acesso
+// indexado com at(), varredura e sort.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -I. tests/DequeBench.cpp -o deque_bench
+// Argumentos opcionais: elementos dos padrões nas pontas (padrão 1000000)
+// e elementos dos padrões indexados (padrão 20000; at() do List é O(n)).
+
+#include "Deque.h"
+#include "List.h"
+#include "TestSupport.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template<typename Container>
+void fill(Container& container, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        container.pushBack(static_cast<long>(i));
+    }
+}
+
+template<typename Container>
+void runAll(const char* label, size_t count, size_t indexedCount) {
+    auto report = [label](const char* pattern, double ms, size_t operations) {
+        std::string name = std::string(label) + " " + pattern;
+        test_support::report(name.c_str(), ms, static_cast<double>(operations));
+    };
+    long checksum = 0;
+
+    {
+        Container container;
+        double ms = test_support::measureMs([&] {
+            fill(container, count);
+            while (!container.empty()) {
+                checksum += container.popFrontAndReturn();
+            }
+        });
+        report("fila (pushBack + popFront)", ms, 2 * count);
+    }
+    {
+        Container container;
+        double ms = test_support::measureMs([&] {
+            for (size_t i = 0; i < count; ++i) {
+                if (i % 2 == 0) {
+                    container.pushFront(static_cast<long>(i));
+                } else {
+                    container.pushBack(static_cast<long>(i));
+                }
+            }
+        });
+        checksum += static_cast<long>(container.size());
+        report("pushFront/pushBack alternados", ms, count);
+    }
+    {
+        // Janela de 1024 elementos que desliza: cruza bordas de bloco sem parar
+        Container container;
+        fill(container, 1024);
+        double ms = test_support::measureMs([&] {
+            for (size_t i = 0; i < count; ++i) {
+                container.pushBack(static_cast<long>(i));
+                checksum += container.popFrontAndReturn();
+            }
+        });
+        report("janela deslizante", ms, count);
+    }
+    {
+        Container container;
+        fill(container, indexedCount);
+        double ms = test_support::measureMs([&] {
+            for (size_t i = 0; i < indexedCount; ++i) {
+                checksum += container.at(i);
+            }
+        });
+        report("at() sequencial", ms, indexedCount);
+
+        std::mt19937 random(40);
+        std::vector<size_t> positions(indexedCount);
+        for (size_t& position : positions) {
+            position = random() % indexedCount;
+        }
+        ms = test_support::measureMs([&] {
+            for (size_t position : positions) {
+                checksum += container.at(position);
+            }
+        });
+        report("at() em posições sorteadas", ms, indexedCount);
+
+        // Acesso em passo fixo, como ao amostrar a cada k elementos
+        ms = test_support::measureMs([&] {
+            for (size_t i = 0; i < indexedCount; i += 16) {
+                container.at(i) += 1;
+            }
+        });
+        report("at() com passo 16", ms, indexedCount / 16);
+    }
+    {
+        Container container;
+        fill(container, count);
+        double ms = test_support::measureMs([&] {
+            for (long value : container) {
+                checksum += value;
+            }
+        });
+        report("varredura com iterador", ms, count);
+        ms = test_support::measureMs([&] {
+            checksum += container.template reduce<long>(0, [](long sum, const long& value) { return sum + value; });
+        });
+        report("reduce", ms, count);
+    }
+    {
+        std::mt19937 random(41);
+        Container container;
+        for (size_t i = 0; i < count; ++i) {
+            container.pushBack(static_cast<long>(random()));
+        }
+        double ms = test_support::measureMs([&] { container.sort(); });
+        checksum += container.front();
+        report("sort de valores sorteados", ms, count);
+    }
+    test_support::keep(checksum);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+    long indexedCount = argc > 2 ? std::atol(argv[2]) : 20000;
+    if (count <= 0 || indexedCount <= 0) {
+        std::fprintf(stderr, "uso: %s [elementos] [elementos indexados]\n", argv[0]);
+        return 2;
+    }
+
+    runAll<Deque<long>>("Deque", static_cast<size_t>(count), static_cast<size_t>(indexedCount));
+    runAll<List<long>>("List", static_cast<size_t>(count), static_cast<size_t>(indexedCount));
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Benchmark do ForkJoinPool: fib recursivo e quicksort paralelo sobre
+// segmentos de List, com 1, 2 e 4 workers, contra a versão sequencial.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/ForkJoinBench.cpp -o forkjoin_bench
+// Argumentos opcionais: n do fib (padrão 30) e elementos do sort
+// (padrão 1000000).
+// Com menos núcleos que workers, o ganho não aparece: os números medem
+// então o custo de fork/join e do roubo de tarefas.
+
+#include "ForkJoinPool.h"
+#include "List.h"
+#include "TestSupport.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Abaixo destes tamanhos a recursão segue sequencial: fork custa mais
+// que o trabalho que delegaria
+constexpr int fibCutoff = 12;
+constexpr size_t sortCutoff = 4096;
+
+long fibSequential(int n) {
+    return n < 2 ? n : fibSequential(n - 1) + fibSequential(n - 2);
+}
+
+long fibParallel(ForkJoinPool& pool, int n) {
+    if (n < fibCutoff) {
+        return fibSequential(n);
+    }
+    auto left = pool.fork([&pool, n] { return fibParallel(pool, n - 1); });
+    long right = fibParallel(pool, n - 2);
+    return left.join() + right;
+}
+
+// Move todos os nós de from para o fim de to (splice, sem alocação)
+void appendAll(List<long>& to, List<long>& from) {
+    while (!from.empty()) {
+        to.splice(to.end(), from, from.begin());
+    }
+}
+
+// Quicksort: particiona o segmento em três Lists em torno do pivô, ordena
+// os menores numa subtarefa e os maiores no thread atual, e religa tudo
+void quicksort(ForkJoinPool& pool, List<long>& list) {
+    if (list.size() < sortCutoff) {
+        list.sort();
+        return;
+    }
+    long pivot = list.front();
+    List<long> less;
+    List<long> equal;
+    List<long> greater;
+    while (!list.empty()) {
+        auto it = list.begin();
+        List<long>& target = *it < pivot ? less : (pivot < *it ? greater : equal);
+        target.splice(target.end(), list, it);
+    }
+
+    auto left = pool.fork([&pool, &less] { quicksort(pool, less); });
+    quicksort(pool, greater);
+    left.join();
+
+    appendAll(list, less);
+    appendAll(list, equal);
+    appendAll(list, greater);
+}
+
+List<long> build(const std::vector<long>& values) {
+    List<long> list;
+    for (long value : values) {
+        list.pushBack(value);
+    }
+    return list;
+}
+
+// Chamadas feitas por fibSequential(n): 2 * fib(n + 1) - 1
+double fibCalls(int n) {
+    long previous = 0;
+    long current = 1;
+    for (int i = 0; i < n; ++i) {
+        long next = previous + current;
+        previous = current;
+        current = next;
+    }
+    return 2.0 * static_cast<double>(current) - 1.0;
+}
+
+void fibSection(int n) {
+    double calls = fibCalls(n);
+    long expected = 0;
+    double ms = test_support::measureMs([&] { expected = fibSequential(n); });
+    std::string name = "fib(" + std::to_string(n) + ") sequencial";
+    test_support::report(name.c_str(), ms, calls);
+
+    for (size_t workers : {1, 2, 4}) {
+        ForkJoinPool pool(workers);
+        long result = 0;
+        ms = test_support::measureMs([&] { result = pool.invoke([&] { return fibParallel(pool, n); }); });
+        STRESS_CHECK(result == expected);
+        name = "fib(" + std::to_string(n) + ") " + std::to_string(workers) + " workers";
+        test_support::report(name.c_str(), ms, calls);
+    }
+}
+
+void sortSection(size_t count) {
+    std::mt19937_64 random(47);
+    std::vector<long> values(count);
+    for (long& value : values) {
+        value = static_cast<long>(random() >> 1);
+    }
+    std::vector<long> expected(values);
+    std::sort(expected.begin(), expected.end());
+    double n = static_cast<double>(count);
+
+    List<long> list = build(values);
+    double ms = test_support::measureMs([&] { list.sort(); });
+    STRESS_CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    test_support::report("List::sort sequencial", ms, n);
+
+    for (size_t workers : {1, 2, 4}) {
+        ForkJoinPool pool(workers);
+        list = build(values);
+        ms = test_support::measureMs([&] { pool.invoke([&] { quicksort(pool, list); }); });
+        STRESS_CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        std::string name = "quicksort " + std::to_string(workers) + " workers";
+        test_support::report(name.c_str(), ms, n);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 30;
+    long count = argc > 2 ? std::atol(argv[2]) : 1000000;
+    if (n <= 0 || n > 45 || count <= 0) {
+        std::fprintf(stderr, "uso: %s [n do fib, até 45] [elementos]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("%u threads de hardware\n", std::thread::hardware_concurrency());
+    fibSection(n);
+    sortSection(static_cast<size_t>(count));
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
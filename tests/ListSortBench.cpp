@@ -0,0 +1,140 @@
+// Benchmark das ordenações do List: radixSort contra sort (merge natural)
+// para chaves aritméticas, e sort conforme o quanto a entrada já está
+// ordenada, com std::list::sort como referência.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -I. tests/ListSortBench.cpp -o list_sort_bench
+// Argumento opcional: número de elementos (padrão 1000000).
+// Cada medida é a melhor de três rodadas; montar a lista fica fora do tempo.
+
+#include "List.h"
+#include "TestSupport.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int rounds = 3;
+
+template<typename T>
+List<T> build(const std::vector<T>& values) {
+    List<T> list;
+    for (const T& value : values) {
+        list.pushBack(value);
+    }
+    return list;
+}
+
+// Melhor tempo de sortFn sobre cópias novas de values; confere o resultado
+template<typename T, typename SortFunction>
+double bestOf(const std::vector<T>& values, SortFunction sortFn) {
+    std::vector<T> expected(values);
+    std::sort(expected.begin(), expected.end());
+
+    double best = 0;
+    for (int round = 0; round < rounds; ++round) {
+        List<T> list = build(values);
+        double ms = test_support::measureMs([&] { sortFn(list); });
+        STRESS_CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        best = round == 0 ? ms : std::min(best, ms);
+    }
+    return best;
+}
+
+template<typename T>
+void compareRadix(const char* label, const std::vector<T>& values) {
+    double n = static_cast<double>(values.size());
+    std::string name = std::string(label) + " sort";
+    test_support::report(name.c_str(), bestOf(values, [](List<T>& list) { list.sort(); }), n);
+    name = std::string(label) + " radixSort";
+    test_support::report(name.c_str(), bestOf(values, [](List<T>& list) { list.radixSort(); }), n);
+}
+
+void radixSection(size_t count) {
+    std::mt19937_64 random(26);
+    std::vector<int32_t> ints(count);
+    std::vector<uint64_t> wide(count);
+    std::vector<double> doubles(count);
+    std::vector<int32_t> narrow(count);
+    std::uniform_real_distribution<double> real(-1e9, 1e9);
+    for (size_t i = 0; i < count; ++i) {
+        ints[i] = static_cast<int32_t>(random());
+        wide[i] = random();
+        doubles[i] = real(random);
+        narrow[i] = static_cast<int32_t>(random() % 1000); // Bytes altos iguais: passadas puladas
+    }
+
+    std::printf("== radixSort x sort, %zu elementos\n", count);
+    compareRadix("int32 uniforme", ints);
+    compareRadix("int32 em [0, 1000)", narrow);
+    compareRadix("uint64 uniforme", wide);
+    compareRadix("double uniforme", doubles);
+}
+
+// Entradas com graus diferentes de ordenação prévia
+std::vector<int> presorted(size_t count, const char* kind, std::mt19937_64& random) {
+    std::vector<int> values(count);
+    std::string name(kind);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    if (name == "embaralhada") {
+        std::shuffle(values.begin(), values.end(), random);
+    } else if (name == "decrescente") {
+        std::reverse(values.begin(), values.end());
+    } else if (name == "0.1% fora do lugar" || name == "1% fora do lugar") {
+        // Eventos em ordem de tempo com alguns atrasados: troca pares ao acaso
+        size_t swaps = count / (name[0] == '0' ? 2000 : 200);
+        for (size_t i = 0; i < swaps; ++i) {
+            std::swap(values[random() % count], values[random() % count]);
+        }
+    } else if (name == "16 blocos ordenados") {
+        // Concatenação de 16 sequências ordenadas, intercaladas por valor
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<int>((i % (count / 16 + 1)) * 16 + i / (count / 16 + 1));
+        }
+    }
+    return values;
+}
+
+void presortednessSection(size_t count) {
+    std::mt19937_64 random(36);
+    std::printf("== sort por grau de ordenação prévia, %zu elementos\n", count);
+    for (const char* kind : {"crescente", "decrescente", "0.1% fora do lugar", "1% fora do lugar",
+                             "16 blocos ordenados", "embaralhada"}) {
+        std::vector<int> values = presorted(count, kind, random);
+        double n = static_cast<double>(values.size());
+
+        std::string name = std::string("List::sort ") + kind;
+        test_support::report(name.c_str(), bestOf(values, [](List<int>& list) { list.sort(); }), n);
+
+        double best = 0;
+        for (int round = 0; round < rounds; ++round) {
+            std::list<int> reference(values.begin(), values.end());
+            double ms = test_support::measureMs([&] { reference.sort(); });
+            STRESS_CHECK(std::is_sorted(reference.begin(), reference.end()));
+            best = round == 0 ? ms : std::min(best, ms);
+        }
+        name = std::string("std::list::sort ") + kind;
+        test_support::report(name.c_str(), best, n);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+    if (count <= 0) {
+        std::fprintf(stderr, "uso: %s [elementos]\n", argv[0]);
+        return 2;
+    }
+    radixSection(static_cast<size_t>(count));
+    presortednessSection(static_cast<size_t>(count));
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
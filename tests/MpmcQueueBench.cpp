@@ -0,0 +1,126 @@
+// Benchmark do MpmcQueue: vazão por número de produtores e consumidores,
+// pelos caminhos de um elemento e em lote.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/MpmcQueueBench.cpp -o mpmc_bench
+// Argumentos opcionais: total de elementos por rodada (padrão 2000000) e
+// capacidade da fila (padrão 1024).
+// Os números só fazem sentido com pelo menos produtores + consumidores
+// núcleos livres; em menos núcleos a medida é dominada pelo escalonador.
+
+#include "MpmcQueue.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t batchSize = 32;
+
+// Retorna a soma recebida para conferir que nada se perdeu
+long run(int producers, int consumers, long total, size_t capacity, bool bulk) {
+    MpmcQueue<long> queue(capacity);
+    long perProducer = total / producers;
+    long expected = perProducer * producers;
+    std::atomic<long> consumed{0};
+    std::atomic<long> sum{0};
+    std::atomic<bool> start{false};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            long batch[batchSize];
+            long next = 0;
+            while (next < perProducer) {
+                if (!bulk) {
+                    queue.enqueue(next++);
+                    continue;
+                }
+                size_t count = batchSize;
+                if (static_cast<long>(count) > perProducer - next) {
+                    count = static_cast<size_t>(perProducer - next);
+                }
+                for (size_t k = 0; k < count; ++k) {
+                    batch[k] = next + static_cast<long>(k);
+                }
+                size_t done = 0;
+                while (done < count) {
+                    size_t pushed = queue.tryEnqueueBulk(batch + done, count - done);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    done += pushed;
+                }
+                next += static_cast<long>(count);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            long buffer[batchSize];
+            long localSum = 0;
+            while (consumed.load(std::memory_order_relaxed) < expected) {
+                size_t got = bulk ? queue.tryDequeueBulk(buffer, batchSize)
+                                  : (queue.tryDequeue(buffer[0]) ? 1 : 0);
+                if (got == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (size_t k = 0; k < got; ++k) {
+                    localSum += buffer[k];
+                }
+                consumed.fetch_add(static_cast<long>(got), std::memory_order_relaxed);
+            }
+            sum.fetch_add(localSum, std::memory_order_relaxed);
+        });
+    }
+
+    double ms = test_support::measureMs([&] {
+        start.store(true, std::memory_order_release);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+
+    std::string name = std::to_string(producers) + "P/" + std::to_string(consumers) + "C " +
+                       (bulk ? "lote" : "um a um");
+    test_support::report(name.c_str(), ms, static_cast<double>(expected));
+    return sum.load() - producers * (perProducer * (perProducer - 1) / 2);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long total = argc > 1 ? std::atol(argv[1]) : 2000000;
+    size_t capacity = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 1024;
+    if (total <= 0 || capacity == 0) {
+        std::fprintf(stderr, "uso: %s [elementos] [capacidade]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("%u threads de hardware, capacidade %zu\n", std::thread::hardware_concurrency(), capacity);
+    const int counts[] = {1, 2, 4, 8};
+    long mismatch = 0;
+    for (bool bulk : {false, true}) {
+        for (int producers : counts) {
+            for (int consumers : counts) {
+                mismatch |= run(producers, consumers, total, capacity, bulk);
+            }
+        }
+    }
+    if (mismatch != 0) {
+        std::fprintf(stderr, "soma recebida diferente da enviada\n");
+        return 1;
+    }
+    return 0;
+}
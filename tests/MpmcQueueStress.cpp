@@ -0,0 +1,380 @@
+// Teste de estresse do MpmcQueue: nenhum elemento pode ser perdido nem
+// duplicado, pelos caminhos de um elemento e em lote.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O1 -g -pthread -fsanitize=address,undefined -I. tests/MpmcQueueStress.cpp -o mpmc_stress
+//     g++ -std=c++17 -O1 -g -pthread -fsanitize=thread -I. tests/MpmcQueueStress.cpp -o mpmc_stress_tsan
+// Argumento opcional: elementos por produtor (padrão 20000; use mais para
+// rodadas longas em máquinas com vários núcleos).
+// Retorna 0 e imprime "OK" se todas as verificações passarem. Um slot
+// reservado e nunca liberado trava o programa em vez de falhar.
+
+#include "MpmcQueue.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+enum class ProducerMode { Single, Blocking, Bulk };
+enum class ConsumerMode { Single, Bulk, Blocking };
+
+struct Scenario {
+    int producers;
+    int consumers;
+    size_t capacity;
+    bool blockingConsumer; // Um único consumidor com dequeueAndReturn
+};
+
+// Valor = produtor * perProducer + sequência
+void runScenario(const Scenario& scenario, long perProducer) {
+    MpmcQueue<long> queue(scenario.capacity);
+    long total = scenario.producers * perProducer;
+    std::vector<std::atomic<int>> seen(static_cast<size_t>(total));
+    std::atomic<long> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < scenario.producers; ++p) {
+        threads.emplace_back([&, p] {
+            ProducerMode mode = static_cast<ProducerMode>(p % 3);
+            long base = p * perProducer;
+            long next = 0;
+            while (next < perProducer) {
+                if (mode == ProducerMode::Bulk) {
+                    // Lotes de tamanho variável, inclusive maiores que a capacidade
+                    long batch[19];
+                    size_t count = 1 + static_cast<size_t>(next % 19);
+                    if (static_cast<long>(count) > perProducer - next) {
+                        count = static_cast<size_t>(perProducer - next);
+                    }
+                    for (size_t k = 0; k < count; ++k) {
+                        batch[k] = base + next + static_cast<long>(k);
+                    }
+                    size_t done = 0;
+                    while (done < count) {
+                        size_t pushed = queue.tryEnqueueBulk(batch + done, count - done);
+                        STRESS_CHECK(pushed <= count - done);
+                        if (pushed == 0) {
+                            std::this_thread::yield();
+                        }
+                        done += pushed;
+                    }
+                    next += static_cast<long>(count);
+                } else if (mode == ProducerMode::Blocking) {
+                    queue.enqueue(base + next++);
+                } else {
+                    while (!queue.tryEnqueue(base + next)) {
+                        std::this_thread::yield();
+                    }
+                    ++next;
+                }
+            }
+        });
+    }
+
+    for (int c = 0; c < scenario.consumers; ++c) {
+        threads.emplace_back([&, c] {
+            ConsumerMode mode = scenario.blockingConsumer ? ConsumerMode::Blocking
+                                                          : static_cast<ConsumerMode>(c % 2);
+            // Ordem por produtor vista por um mesmo consumidor é crescente
+            std::vector<long> last(static_cast<size_t>(scenario.producers), -1);
+            auto record = [&](long value) {
+                bool inRange = value >= 0 && value < total;
+                STRESS_CHECK(inRange);
+                if (!inRange) {
+                    return;
+                }
+                STRESS_CHECK(seen[static_cast<size_t>(value)].fetch_add(1, std::memory_order_relaxed) == 0);
+                size_t producer = static_cast<size_t>(value / perProducer);
+                STRESS_CHECK(value % perProducer > last[producer]);
+                last[producer] = value % perProducer;
+            };
+
+            if (mode == ConsumerMode::Blocking) {
+                for (long i = 0; i < total; ++i) {
+                    record(queue.dequeueAndReturn());
+                }
+                consumed.fetch_add(total, std::memory_order_relaxed);
+                return;
+            }
+
+            long buffer[23];
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                size_t got = 0;
+                if (mode == ConsumerMode::Bulk) {
+                    got = queue.tryDequeueBulk(buffer, 1 + static_cast<size_t>(c) * 7 % 23);
+                } else if (queue.tryDequeue(buffer[0])) {
+                    got = 1;
+                }
+                for (size_t k = 0; k < got; ++k) {
+                    record(buffer[k]);
+                }
+                if (got == 0) {
+                    std::this_thread::yield();
+                } else {
+                    consumed.fetch_add(static_cast<long>(got), std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    STRESS_CHECK(consumed.load() == total);
+    for (long i = 0; i < total; ++i) {
+        STRESS_CHECK(seen[static_cast<size_t>(i)].load() == 1);
+    }
+    STRESS_CHECK(queue.emptyApprox());
+    STRESS_CHECK(queue.sizeApprox() == 0);
+}
+
+// Tipo com posse: perda ou duplicação aparece como vazamento ou double free
+void runOwnership() {
+    MpmcQueue<std::unique_ptr<long>> queue(4);
+    const long perProducer = 20000;
+    std::atomic<long> sum{0};
+    std::atomic<long> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 2; ++p) {
+        threads.emplace_back([&] {
+            for (long i = 1; i <= perProducer; ++i) {
+                // tryEnqueue que falha não pode consumir o valor
+                std::unique_ptr<long> item(new long(i));
+                while (!queue.tryEnqueue(std::move(item))) {
+                    STRESS_CHECK(item != nullptr);
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            std::unique_ptr<long> item;
+            while (consumed.load(std::memory_order_relaxed) < 2 * perProducer) {
+                if (queue.tryDequeue(item)) {
+                    sum.fetch_add(*item, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    STRESS_CHECK(sum.load() == perProducer * (perProducer + 1));
+}
+
+// Tipo cuja cópia e atribuição por movimento podem lançar; o construtor
+// por movimento não lança, como a fila exige. live conta instâncias vivas.
+std::atomic<long> live{0};
+
+struct Fragile {
+    long value;
+    bool throwOnCopy;
+    bool throwOnAssign;
+
+    explicit Fragile(long v = -1, bool copyThrows = false, bool assignThrows = false)
+        : value(v), throwOnCopy(copyThrows), throwOnAssign(assignThrows) {
+        live.fetch_add(1, std::memory_order_relaxed);
+    }
+    Fragile(const Fragile& other) : value(other.value), throwOnCopy(false), throwOnAssign(other.throwOnAssign) {
+        if (other.throwOnCopy) {
+            throw std::runtime_error("copy");
+        }
+        live.fetch_add(1, std::memory_order_relaxed);
+    }
+    Fragile(Fragile&& other) noexcept
+        : value(other.value), throwOnCopy(other.throwOnCopy), throwOnAssign(other.throwOnAssign) {
+        live.fetch_add(1, std::memory_order_relaxed);
+    }
+    Fragile& operator=(const Fragile&) = default;
+    Fragile& operator=(Fragile&& other) {
+        if (other.throwOnAssign) {
+            throw std::runtime_error("assign");
+        }
+        value = other.value;
+        throwOnCopy = other.throwOnCopy;
+        throwOnAssign = other.throwOnAssign;
+        return *this;
+    }
+    ~Fragile() { live.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+// Cópias que lançam nos produtores (um elemento e em lote) e atribuições
+// que lançam em tryDequeue: cada valor é entregue ou perdido exatamente
+// uma vez, e a fila nunca trava
+void runThrowingCopies() {
+    const long perProducer = 5000;
+    const int producers = 2;
+    const long total = producers * perProducer;
+    {
+        MpmcQueue<Fragile> queue(4);
+        std::vector<std::atomic<int>> seen(static_cast<size_t>(total));
+        std::atomic<long> settled{0}; // entregues + perdidos na atribuição
+        std::atomic<long> lost{0};
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (long i = 0; i < perProducer; ++i) {
+                    long value = p * perProducer + i;
+                    Fragile item(value, i % 3 == 0, i % 7 == 0);
+                    bool done = false;
+                    while (!done) {
+                        try {
+                            if (p == 0) {
+                                queue.enqueue(item);
+                                done = true;
+                            } else {
+                                done = queue.tryEnqueueBulk(&item, 1) == 1;
+                                if (!done) {
+                                    std::this_thread::yield();
+                                }
+                            }
+                        } catch (const std::runtime_error&) {
+                            // A cópia lançou antes de reservar o slot: tenta de novo
+                            item.throwOnCopy = false;
+                        }
+                    }
+                }
+            });
+        }
+        threads.emplace_back([&] {
+            Fragile out;
+            while (settled.load(std::memory_order_relaxed) < total) {
+                try {
+                    if (!queue.tryDequeue(out)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                } catch (const std::runtime_error&) {
+                    lost.fetch_add(1, std::memory_order_relaxed);
+                    settled.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                bool inRange = out.value >= 0 && out.value < total;
+                STRESS_CHECK(inRange);
+                if (inRange) {
+                    STRESS_CHECK(seen[static_cast<size_t>(out.value)].fetch_add(1) == 0);
+                    STRESS_CHECK(out.value % perProducer % 7 != 0);
+                }
+                settled.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        STRESS_CHECK(lost.load() == producers * ((perProducer + 6) / 7));
+        for (long i = 0; i < total; ++i) {
+            STRESS_CHECK(seen[static_cast<size_t>(i)].load() == (i % perProducer % 7 == 0 ? 0 : 1));
+        }
+        STRESS_CHECK(queue.emptyApprox());
+    }
+    STRESS_CHECK(live.load() == 0);
+}
+
+// Saída de tryDequeueBulk que lança a cada poucas escritas: o lote é
+// descartado, mas os slots voltam para os produtores
+struct ThrowingWriter {
+    std::vector<long>* values;
+    long* writes;
+
+    ThrowingWriter& operator*() { return *this; }
+    ThrowingWriter& operator++() { return *this; }
+    ThrowingWriter& operator=(Fragile&& item) {
+        if (++*writes % 5 == 0) {
+            throw std::runtime_error("writer");
+        }
+        values->push_back(item.value);
+        return *this;
+    }
+};
+
+void runThrowingConsumers() {
+    const long perProducer = 5000;
+    const int producers = 2;
+    const long total = producers * perProducer;
+    {
+        MpmcQueue<Fragile> queue(8);
+        std::atomic<int> producersDone{0};
+        std::vector<std::atomic<int>> seen(static_cast<size_t>(total));
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (long i = 0; i < perProducer; ++i) {
+                    queue.emplace(p * perProducer + i);
+                }
+                producersDone.fetch_add(1);
+            });
+        }
+        for (int c = 0; c < 2; ++c) {
+            threads.emplace_back([&, c] {
+                std::vector<long> values;
+                long writes = c;
+                while (producersDone.load() < producers || !queue.emptyApprox()) {
+                    try {
+                        if (queue.tryDequeueBulk(ThrowingWriter{&values, &writes}, 3) == 0) {
+                            std::this_thread::yield();
+                        }
+                    } catch (const std::runtime_error&) {
+                    }
+                }
+                for (long value : values) {
+                    bool inRange = value >= 0 && value < total;
+                    STRESS_CHECK(inRange);
+                    if (inRange) {
+                        STRESS_CHECK(seen[static_cast<size_t>(value)].fetch_add(1) == 0);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        // Todos os slots descartados foram liberados: a fila enche de novo
+        STRESS_CHECK(queue.sizeApprox() == 0);
+        for (size_t i = 0; i < queue.capacity(); ++i) {
+            STRESS_CHECK(queue.tryEmplace(static_cast<long>(i)));
+        }
+        STRESS_CHECK(!queue.tryEmplace(-1L));
+    }
+    STRESS_CHECK(live.load() == 0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long perProducer = argc > 1 ? std::atol(argv[1]) : 20000;
+    if (perProducer <= 0) {
+        std::cerr << "uso: " << argv[0] << " [elementos por produtor]\n";
+        return 2;
+    }
+
+    const Scenario scenarios[] = {
+        {1, 1, 2, false},
+        {2, 2, 8, false},
+        {3, 3, 64, false},
+        {4, 1, 16, false},
+        {1, 4, 16, false},
+        {4, 4, 4, false},
+        {3, 1, 8, true},
+    };
+    for (const Scenario& scenario : scenarios) {
+        runScenario(scenario, perProducer);
+    }
+    runOwnership();
+    runThrowingCopies();
+    runThrowingConsumers();
+
+    return test_support::finish();
+}
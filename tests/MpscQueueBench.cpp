@@ -0,0 +1,119 @@
+// Benchmark do MpscQueue: custo de envio para caixas de mensagens e
+// alocações de nós, contra um Queue protegido por mutex.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/MpscQueueBench.cpp -o mpsc_bench
+// Argumento opcional: mensagens por rodada (padrão 2000000).
+// Os contadores de memória (CONTAINERS_MEMORY_COUNTERS) ficam ativos para
+// contar as alocações de nós do MpscQueue.
+
+#define CONTAINERS_MEMORY_COUNTERS
+#include "MpscQueue.h"
+#include "Queue.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Referência: a caixa de mensagens com mutex que o MpscQueue substitui
+struct LockedMailbox {
+    std::mutex mutex;
+    Queue<long> queue;
+
+    void enqueue(long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(value);
+    }
+
+    template<typename Callback>
+    size_t drainAll(Callback callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t count = 0;
+        while (!queue.empty()) {
+            callback(queue.dequeueAndReturn());
+            ++count;
+        }
+        return count;
+    }
+};
+
+size_t nodeAllocations() {
+    return MemoryCounters::snapshot(ContainerKind::Queue).allocations;
+}
+
+// producers threads enviam total mensagens; o dono esvazia com drainAll.
+// Com maxInFlight > 0 os produtores esperam o consumidor (fluxo contínuo);
+// com 0 enviam em rajada.
+template<typename Mailbox>
+void run(const char* label, int producers, long total, long maxInFlight) {
+    Mailbox mailbox;
+    long perProducer = total / producers;
+    long expected = perProducer * producers;
+    std::atomic<long> received{0};
+    std::atomic<bool> start{false};
+    size_t allocationsBefore = nodeAllocations();
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (long i = 0; i < perProducer; ++i) {
+                while (maxInFlight > 0 && i * producers - received.load(std::memory_order_relaxed) > maxInFlight) {
+                    std::this_thread::yield();
+                }
+                mailbox.enqueue(i);
+            }
+        });
+    }
+
+    long sum = 0;
+    double ms = test_support::measureMs([&] {
+        start.store(true, std::memory_order_release);
+        while (received.load(std::memory_order_relaxed) < expected) {
+            size_t got = mailbox.drainAll([&sum](long&& value) { sum += value; });
+            if (got == 0) {
+                std::this_thread::yield();
+            } else {
+                received.fetch_add(static_cast<long>(got), std::memory_order_relaxed);
+            }
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+    STRESS_CHECK(sum == producers * (perProducer * (perProducer - 1) / 2));
+
+    std::string name = std::string(label) + " " + std::to_string(producers) + "P " +
+                       (maxInFlight > 0 ? "<=" + std::to_string(maxInFlight) : std::string("rajada"));
+    test_support::report(name.c_str(), ms, static_cast<double>(expected));
+    if (MemoryCounters::enabled && std::string(label) == "MpscQueue") {
+        std::printf("%-40s %zu alocações de nós\n", "", nodeAllocations() - allocationsBefore);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long total = argc > 1 ? std::atol(argv[1]) : 2000000;
+    if (total <= 0) {
+        std::fprintf(stderr, "uso: %s [mensagens]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("%u threads de hardware\n", std::thread::hardware_concurrency());
+    for (long maxInFlight : {200L, 0L}) {
+        for (int producers : {1, 2, 4, 8}) {
+            run<MpscQueue<long>>("MpscQueue", producers, total, maxInFlight);
+            run<LockedMailbox>("Queue + mutex", producers, total, maxInFlight);
+        }
+    }
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+// Benchmark do PriorityQueue (heap d-ário) e do PairingHeap contra
+// std::priority_queue: inserir tudo e retirar tudo, fila de tamanho
+// estável (escalonador) e Dijkstra com decreaseKey.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -I. tests/PriorityQueueBench.cpp -o priority_queue_bench
+// Argumento opcional: número de elementos (padrão 1000000).
+// No Dijkstra, std::priority_queue não tem decreaseKey: reinsere o vértice
+// e descarta as entradas vencidas ao retirá-las (a forma usual).
+
+#include "PairingHeap.h"
+#include "PriorityQueue.h"
+#include "TestSupport.h"
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Adaptadores com a interface comum usada pelas medidas
+template<typename T, typename Compare>
+struct StdQueue {
+    std::priority_queue<T, std::vector<T>, Compare> queue;
+
+    void enqueue(const T& value) { queue.push(value); }
+    T dequeueAndReturn() {
+        T value = queue.top();
+        queue.pop();
+        return value;
+    }
+    bool empty() const { return queue.empty(); }
+};
+
+template<typename T, typename Compare, size_t Arity>
+struct DAryQueue {
+    PriorityQueue<T, Compare, Arity> queue;
+
+    void enqueue(const T& value) { queue.enqueue(value); }
+    T dequeueAndReturn() { return queue.dequeueAndReturn(); }
+    bool empty() const { return queue.empty(); }
+};
+
+template<typename T, typename Compare>
+struct PairingQueue {
+    PairingHeap<T, Compare> queue;
+
+    void enqueue(const T& value) { queue.enqueue(value); }
+    T dequeueAndReturn() { return queue.dequeueAndReturn(); }
+    bool empty() const { return queue.empty(); }
+};
+
+// Insere todos os valores e retira todos; confere a ordem decrescente
+template<typename Queue>
+void fillAndDrain(const char* label, const std::vector<int>& values) {
+    Queue queue;
+    bool ordered = true;
+    double ms = test_support::measureMs([&] {
+        for (int value : values) {
+            queue.enqueue(value);
+        }
+        int previous = std::numeric_limits<int>::max();
+        while (!queue.empty()) {
+            int value = queue.dequeueAndReturn();
+            ordered = ordered && value <= previous;
+            previous = value;
+        }
+    });
+    STRESS_CHECK(ordered);
+    std::string name = std::string(label) + " enche e esvazia";
+    test_support::report(name.c_str(), ms, 2.0 * static_cast<double>(values.size()));
+}
+
+// Tamanho estável: cada passo retira o próximo evento e agenda outro mais
+// adiante (modelo "hold" de simulação de eventos)
+template<typename Queue>
+void hold(const char* label, size_t size, size_t steps) {
+    Queue queue;
+    std::mt19937 random(48);
+    for (size_t i = 0; i < size; ++i) {
+        queue.enqueue(static_cast<long>(random() % 1000000));
+    }
+    long checksum = 0;
+    double ms = test_support::measureMs([&] {
+        for (size_t i = 0; i < steps; ++i) {
+            long now = queue.dequeueAndReturn();
+            checksum += now;
+            queue.enqueue(now + 1 + static_cast<long>(random() % 1000000));
+        }
+    });
+    test_support::keep(checksum);
+    std::string name = std::string(label) + " hold " + std::to_string(size);
+    test_support::report(name.c_str(), ms, 2.0 * static_cast<double>(steps));
+}
+
+// Grafo aleatório em listas de adjacência
+struct Graph {
+    std::vector<size_t> offsets;
+    std::vector<int> targets;
+    std::vector<long> weights;
+};
+
+Graph randomGraph(int vertices, int degree) {
+    std::mt19937 random(480);
+    Graph graph;
+    graph.offsets.push_back(0);
+    for (int v = 0; v < vertices; ++v) {
+        for (int e = 0; e < degree; ++e) {
+            graph.targets.push_back(static_cast<int>(random() % static_cast<unsigned>(vertices)));
+            graph.weights.push_back(1 + static_cast<long>(random() % 1000));
+        }
+        graph.offsets.push_back(graph.targets.size());
+    }
+    return graph;
+}
+
+struct Visit {
+    long distance;
+    int vertex;
+};
+
+// Menor distância primeiro: "prioridade menor" é a distância maior
+struct FartherFirst {
+    bool operator()(const Visit& a, const Visit& b) const { return a.distance > b.distance; }
+};
+
+constexpr long unreached = std::numeric_limits<long>::max();
+
+// Dijkstra com reinserção (std::priority_queue)
+std::vector<long> dijkstraLazy(const Graph& graph, int source) {
+    std::vector<long> distance(graph.offsets.size() - 1, unreached);
+    std::priority_queue<Visit, std::vector<Visit>, FartherFirst> queue;
+    distance[static_cast<size_t>(source)] = 0;
+    queue.push({0, source});
+    while (!queue.empty()) {
+        Visit visit = queue.top();
+        queue.pop();
+        size_t from = static_cast<size_t>(visit.vertex);
+        if (visit.distance != distance[from]) {
+            continue; // Entrada vencida
+        }
+        for (size_t e = graph.offsets[from]; e < graph.offsets[from + 1]; ++e) {
+            size_t to = static_cast<size_t>(graph.targets[e]);
+            long candidate = visit.distance + graph.weights[e];
+            if (candidate < distance[to]) {
+                distance[to] = candidate;
+                queue.push({candidate, graph.targets[e]});
+            }
+        }
+    }
+    return distance;
+}
+
+// Dijkstra com um handle por vértice e decreaseKey
+template<typename Queue>
+std::vector<long> dijkstraDecreaseKey(const Graph& graph, int source) {
+    using Handle = typename Queue::Handle;
+    size_t vertices = graph.offsets.size() - 1;
+    std::vector<long> distance(vertices, unreached);
+    std::vector<Handle> handles(vertices);
+    std::vector<bool> queued(vertices, false);
+    Queue queue;
+    distance[static_cast<size_t>(source)] = 0;
+    handles[static_cast<size_t>(source)] = queue.enqueue({0, source});
+    queued[static_cast<size_t>(source)] = true;
+    while (!queue.empty()) {
+        Visit visit = queue.dequeueAndReturn();
+        size_t from = static_cast<size_t>(visit.vertex);
+        queued[from] = false;
+        for (size_t e = graph.offsets[from]; e < graph.offsets[from + 1]; ++e) {
+            size_t to = static_cast<size_t>(graph.targets[e]);
+            long candidate = visit.distance + graph.weights[e];
+            if (candidate < distance[to]) {
+                bool first = distance[to] == unreached;
+                distance[to] = candidate;
+                if (queued[to]) {
+                    queue.decreaseKey(handles[to], {candidate, graph.targets[e]});
+                } else if (first) {
+                    handles[to] = queue.enqueue({candidate, graph.targets[e]});
+                    queued[to] = true;
+                }
+            }
+        }
+    }
+    return distance;
+}
+
+void dijkstraSection(int vertices, int degree) {
+    Graph graph = randomGraph(vertices, degree);
+    double edges = static_cast<double>(graph.targets.size());
+    std::string suffix = " Dijkstra grau " + std::to_string(degree);
+
+    std::vector<long> expected;
+    double ms = test_support::measureMs([&] { expected = dijkstraLazy(graph, 0); });
+    test_support::report(("std::priority_queue" + suffix).c_str(), ms, edges);
+
+    std::vector<long> distance;
+    ms = test_support::measureMs(
+        [&] { distance = dijkstraDecreaseKey<PriorityQueue<Visit, FartherFirst, 4>>(graph, 0); });
+    STRESS_CHECK(distance == expected);
+    test_support::report(("PriorityQueue<4>" + suffix).c_str(), ms, edges);
+
+    ms = test_support::measureMs([&] { distance = dijkstraDecreaseKey<PairingHeap<Visit, FartherFirst>>(graph, 0); });
+    STRESS_CHECK(distance == expected);
+    test_support::report(("PairingHeap" + suffix).c_str(), ms, edges);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+    if (count <= 0) {
+        std::fprintf(stderr, "uso: %s [elementos]\n", argv[0]);
+        return 2;
+    }
+    size_t n = static_cast<size_t>(count);
+
+    std::mt19937 random(48);
+    std::vector<int> values(n);
+    for (int& value : values) {
+        value = static_cast<int>(random() >> 1);
+    }
+    std::printf("== inteiros sorteados, %zu elementos\n", n);
+    fillAndDrain<StdQueue<int, std::less<int>>>("std::priority_queue", values);
+    fillAndDrain<DAryQueue<int, std::less<int>, 2>>("PriorityQueue<2>", values);
+    fillAndDrain<DAryQueue<int, std::less<int>, 4>>("PriorityQueue<4>", values);
+    fillAndDrain<PairingQueue<int, std::less<int>>>("PairingHeap", values);
+
+    std::printf("== hold: retira o mínimo e agenda adiante, %zu passos\n", n);
+    for (size_t size : {1000, 100000}) {
+        hold<StdQueue<long, std::greater<long>>>("std::priority_queue", size, n);
+        hold<DAryQueue<long, std::greater<long>, 4>>("PriorityQueue<4>", size, n);
+        hold<PairingQueue<long, std::greater<long>>>("PairingHeap", size, n);
+    }
+
+    int vertices = static_cast<int>(n / 4 > 0 ? n / 4 : 1);
+    std::printf("== Dijkstra, %d vértices\n", vertices);
+    for (int degree : {4, 32}) {
+        dijkstraSection(vertices, degree);
+    }
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+// Benchmark do RcuList: leituras por segundo conforme o número de leitores,
+// com e sem um escritor concorrente, contra um List protegido por mutex.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/RcuListBench.cpp -o rcu_bench
+// Argumento opcional: snapshots por leitor (padrão 200000).
+// Cada leitura abre um snapshot e soma uma lista de 64 elementos.
+// A escala só aparece com pelo menos leitores + 1 núcleos livres.
+
+#include "RcuList.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr long chainLength = 64;
+
+List<long> initialList() {
+    List<long> list;
+    for (long i = 0; i < chainLength; ++i) {
+        list.pushBack(i);
+    }
+    return list;
+}
+
+long sumOf(const List<long>& list) {
+    long sum = 0;
+    for (long value : list) {
+        sum += value;
+    }
+    return sum;
+}
+
+// Roda readers threads de leitura e, se withWriter, um escritor que
+// publica versões até os leitores terminarem
+template<typename ReadFunction, typename WriteFunction>
+void run(const char* label, int readers, long perReader, bool withWriter,
+         ReadFunction read, WriteFunction write) {
+    std::atomic<bool> start{false};
+    std::atomic<int> finished{0};
+    std::atomic<long> checksum{0};
+    long writes = 0;
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            long local = 0;
+            for (long i = 0; i < perReader; ++i) {
+                local += read();
+            }
+            checksum.fetch_add(local, std::memory_order_relaxed);
+            finished.fetch_add(1, std::memory_order_release);
+        });
+    }
+    std::thread writer;
+    if (withWriter) {
+        writer = std::thread([&] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (finished.load(std::memory_order_acquire) < readers) {
+                write();
+                ++writes;
+            }
+        });
+    }
+
+    double ms = test_support::measureMs([&] {
+        start.store(true, std::memory_order_release);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+    if (writer.joinable()) {
+        writer.join();
+    }
+    test_support::keep(checksum);
+
+    std::string name = std::string(label) + " " + std::to_string(readers) + "L" +
+                       (withWriter ? " +E (" + std::to_string(writes) + " escritas)" : "");
+    test_support::report(name.c_str(), ms, static_cast<double>(readers) * static_cast<double>(perReader));
+}
+
+void rcuCase(int readers, long perReader, bool withWriter) {
+    RcuList<long> rcu(initialList(), static_cast<size_t>(readers) + 1);
+    run("RcuList", readers, perReader, withWriter,
+        [&rcu] {
+            // Um Reader por thread, registrado na primeira leitura; cada
+            // caso usa threads novos, que o liberam ao terminar
+            thread_local std::unique_ptr<RcuList<long>::Reader> reader;
+            if (!reader) {
+                reader.reset(new RcuList<long>::Reader(rcu));
+            }
+            auto snapshot = reader->snapshot();
+            return sumOf(snapshot.list());
+        },
+        [&rcu] { rcu.update([](List<long>& list) { list.front() += 1; }); });
+}
+
+void mutexCase(int readers, long perReader, bool withWriter) {
+    std::mutex mutex;
+    List<long> list = initialList();
+    run("mutex", readers, perReader, withWriter,
+        [&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            return sumOf(list);
+        },
+        [&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            list.front() += 1;
+        });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long perReader = argc > 1 ? std::atol(argv[1]) : 200000;
+    if (perReader <= 0) {
+        std::fprintf(stderr, "uso: %s [snapshots por leitor]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("%u threads de hardware\n", std::thread::hardware_concurrency());
+    for (bool withWriter : {false, true}) {
+        for (int readers : {1, 2, 4, 8}) {
+            rcuCase(readers, perReader, withWriter);
+            mutexCase(readers, perReader, withWriter);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Benchmark do ShardedQueue: vazão conforme o número de threads, nos modos
+// Relaxed e StrictFifo, contra um único Queue protegido por mutex.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/ShardedQueueBench.cpp -o sharded_queue_bench
+// Argumentos opcionais: operações por thread (padrão 200000) e número
+// máximo de threads (padrão 64; as medidas dobram de 1 até ele).
+// Cada thread alterna enqueue e dequeue, como um worker que gera e consome
+// tarefas. Com menos núcleos que threads, a vazão não escala: os números
+// medem então a disputa pelos mutexes sob preempção.
+
+#include "Queue.h"
+#include "ShardedQueue.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Referência: o Queue compartilhado que o ShardedQueue substitui
+struct LockedQueue {
+    std::mutex mutex;
+    Queue<long> queue;
+
+    void enqueue(long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(value);
+    }
+
+    bool tryDequeue(long& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        out = queue.dequeueAndReturn();
+        return true;
+    }
+};
+
+struct Sharded {
+    ShardedQueue<long> queue;
+
+    Sharded(size_t shards, ShardOrdering ordering) : queue(shards, ordering) {}
+
+    void enqueue(long value) { queue.enqueue(value); }
+    bool tryDequeue(long& out) { return queue.tryDequeue(out); }
+};
+
+// Cada thread faz perThread pares enqueue/dequeue; no fim, esvazia o resto
+template<typename Channel>
+void run(const char* label, Channel& channel, int threads, long perThread) {
+    std::atomic<bool> start{false};
+    std::atomic<long> sum{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            long local = 0;
+            long value;
+            for (long i = 0; i < perThread; ++i) {
+                channel.enqueue(static_cast<long>(t) * perThread + i);
+                if (channel.tryDequeue(value)) {
+                    local += value;
+                }
+            }
+            sum.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+
+    double ms = test_support::measureMs([&] {
+        start.store(true, std::memory_order_release);
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+
+    long rest = 0;
+    long value;
+    while (channel.tryDequeue(value)) {
+        rest += value;
+    }
+    long total = static_cast<long>(threads) * perThread;
+    STRESS_CHECK(sum.load() + rest == total * (total - 1) / 2);
+
+    std::string name = std::string(label) + " " + std::to_string(threads) + " threads";
+    test_support::report(name.c_str(), ms, 2.0 * static_cast<double>(total));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long perThread = argc > 1 ? std::atol(argv[1]) : 200000;
+    int maxThreads = argc > 2 ? std::atoi(argv[2]) : 64;
+    if (perThread <= 0 || maxThreads <= 0) {
+        std::fprintf(stderr, "uso: %s [operações por thread] [máximo de threads]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("%u threads de hardware\n", std::thread::hardware_concurrency());
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        size_t shards = static_cast<size_t>(threads);
+        {
+            Sharded channel(shards, ShardOrdering::Relaxed);
+            run("ShardedQueue Relaxed", channel, threads, perThread);
+        }
+        {
+            Sharded channel(shards, ShardOrdering::StrictFifo);
+            run("ShardedQueue StrictFifo", channel, threads, perThread);
+        }
+        {
+            LockedQueue channel;
+            run("Queue + mutex", channel, threads, perThread);
+        }
+    }
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+// Benchmark do SpscQueue: vazão e latência de passagem entre dois threads
+// fixados em núcleos distintos, contra um Queue protegido por mutex.
+//
+// Compilação (a partir da raiz do repositório):
+//     g++ -std=c++17 -O2 -pthread -I. tests/SpscQueueBench.cpp -o spsc_bench
+// Argumentos opcionais: elementos (padrão 10000000), núcleo do produtor
+// (padrão 0) e núcleo do consumidor (padrão 1).
+// A fixação em núcleos só existe no Linux; sem ela, ou com um núcleo só,
+// os números medem o escalonador e não a passagem entre caches.
+
+#include "Queue.h"
+#include "SpscQueue.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+constexpr size_t capacity = 1024;
+
+// Fixa o thread atual no núcleo cpu; retorna false se não for possível
+bool pinToCpu(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+// Referência: o Queue com mutex que o SpscQueue substitui
+struct LockedQueue {
+    std::mutex mutex;
+    Queue<long> queue;
+
+    bool tryEnqueue(long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.size() >= capacity) {
+            return false;
+        }
+        queue.enqueue(value);
+        return true;
+    }
+
+    bool tryDequeue(long& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        out = queue.dequeueAndReturn();
+        return true;
+    }
+};
+
+// Vazão: o produtor envia count valores e o consumidor os soma
+template<typename Channel>
+void throughput(const char* name, Channel& channel, long count, int producerCpu, int consumerCpu) {
+    std::atomic<bool> start{false};
+    long sum = 0;
+
+    std::thread consumer([&] {
+        pinToCpu(consumerCpu);
+        while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        long value;
+        for (long i = 0; i < count; ++i) {
+            while (!channel.tryDequeue(value)) {
+                std::this_thread::yield();
+            }
+            sum += value;
+        }
+    });
+
+    double ms = test_support::measureMs([&] {
+        std::thread producer([&] {
+            pinToCpu(producerCpu);
+            start.store(true, std::memory_order_release);
+            for (long i = 0; i < count; ++i) {
+                while (!channel.tryEnqueue(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        producer.join();
+        consumer.join();
+    });
+
+    STRESS_CHECK(sum == count * (count - 1) / 2);
+    test_support::report(name, ms, static_cast<double>(count));
+}
+
+// Latência: pingue-pongue por dois canais; ns/op é meia volta (uma passagem)
+template<typename Channel>
+void roundTrip(const char* name, Channel& ping, Channel& pong, long count, int producerCpu, int consumerCpu) {
+    std::thread echo([&] {
+        pinToCpu(consumerCpu);
+        long value;
+        for (long i = 0; i < count; ++i) {
+            while (!ping.tryDequeue(value)) {
+                std::this_thread::yield();
+            }
+            while (!pong.tryEnqueue(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long checksum = 0;
+    double ms = 0;
+    std::thread sender([&] {
+        pinToCpu(producerCpu);
+        ms = test_support::measureMs([&] {
+            long value;
+            for (long i = 0; i < count; ++i) {
+                while (!ping.tryEnqueue(i)) {
+                    std::this_thread::yield();
+                }
+                while (!pong.tryDequeue(value)) {
+                    std::this_thread::yield();
+                }
+                checksum += value;
+            }
+        });
+    });
+    sender.join();
+    echo.join();
+
+    STRESS_CHECK(checksum == count * (count - 1) / 2);
+    test_support::report(name, ms, 2.0 * static_cast<double>(count));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long count = argc > 1 ? std::atol(argv[1]) : 10000000;
+    int producerCpu = argc > 2 ? std::atoi(argv[2]) : 0;
+    int consumerCpu = argc > 3 ? std::atoi(argv[3]) : 1;
+    if (count <= 0) {
+        std::fprintf(stderr, "uso: %s [elementos] [núcleo produtor] [núcleo consumidor]\n", argv[0]);
+        return 2;
+    }
+
+    unsigned cores = std::thread::hardware_concurrency();
+    std::printf("%u threads de hardware, produtor no núcleo %d, consumidor no %d\n", cores, producerCpu,
+                consumerCpu);
+    // Testa a fixação num thread descartável, sem prender o thread principal
+    bool pinnable = cores >= 2;
+    std::thread([&] { pinnable = pinnable && pinToCpu(producerCpu) && pinToCpu(consumerCpu); }).join();
+    if (!pinnable) {
+        std::printf("aviso: sem dois núcleos fixáveis, os números não medem passagem entre núcleos\n");
+    }
+
+    {
+        SpscQueue<long> channel(capacity);
+        throughput("SpscQueue vazão", channel, count, producerCpu, consumerCpu);
+    }
+    {
+        LockedQueue channel;
+        throughput("Queue + mutex vazão", channel, count, producerCpu, consumerCpu);
+    }
+    long trips = count / 10 > 0 ? count / 10 : 1;
+    {
+        SpscQueue<long> ping(capacity);
+        SpscQueue<long> pong(capacity);
+        roundTrip("SpscQueue pingue-pongue", ping, pong, trips, producerCpu, consumerCpu);
+    }
+    {
+        LockedQueue ping;
+        LockedQueue pong;
+        roundTrip("Queue + mutex pingue-pongue", ping, pong, trips, producerCpu, consumerCpu);
+    }
+    return test_support::failures.load() == 0 ? 0 : 1;
+}
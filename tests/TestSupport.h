@@ -0,0 +1,69 @@
+#ifndef TESTS_TESTSUPPORT_H
+#define TESTS_TESTSUPPORT_H
+
+// Apoio comum dos programas de teste e de benchmark em tests/.
+// Cada programa é compilado sozinho a partir da raiz do repositório
+// (veja as linhas de compilação no topo de cada arquivo).
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+namespace test_support {
+
+// Verificações que falharam, somadas por todos os threads
+inline std::atomic<int> failures{0};
+
+// Encerra um teste: imprime "OK" (mais um resumo opcional) e retorna 0, ou
+// o número de falhas e retorna 1
+inline int finish(const char* summary = nullptr) {
+    int failed = failures.load();
+    if (failed != 0) {
+        std::cerr << failed << " verificações falharam\n";
+        return 1;
+    }
+    std::cout << "OK";
+    if (summary != nullptr) {
+        std::cout << " (" << summary << ")";
+    }
+    std::cout << "\n";
+    return 0;
+}
+
+// Tempo de parede de fn em milissegundos
+template<typename Function>
+double measureMs(Function&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Impede que o otimizador descarte um resultado calculado só para medir
+inline const void* volatile keepSink = nullptr;
+
+template<typename T>
+void keep(const T& value) {
+    keepSink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+// Uma linha de resultado de benchmark: nome, tempo e vazão
+inline void report(const char* name, double ms, double operations) {
+    std::printf("%-40s %10.2f ms %12.2f Mop/s %8.1f ns/op\n", name, ms,
+                operations / ms / 1000.0, ms * 1e6 / operations);
+}
+
+} // namespace test_support
+
+// Verificação que não aborta: registra a falha e continua
+#define STRESS_CHECK(cond)                                                           \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": falhou: " #cond "\n";     \
+            test_support::failures.fetch_add(1, std::memory_order_relaxed);          \
+        }                                                                            \
+    } while (0)
+
+#endif // TESTS_TESTSUPPORT_H